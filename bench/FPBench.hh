@@ -0,0 +1,103 @@
+/// October 19, 2026: Shared pieces of the benchmarks comparing a fast path
+///    against the stock GEANT4 process.
+///
+///    The run manager of the full simulation, a step consumer filling the
+///    histograms of the current measurement, the timed run of one setting
+///    and the two-sample chi2 of the histograms.
+
+#ifndef FPBench_h
+#define FPBench_h 1
+
+#include "G4RunManager.hh"
+#include "G4UImanager.hh"
+#include "Randomize.hh"
+
+#include "FPDetectorConstruction.hh"
+#include "FPActionInitialization.hh"
+#include "FPStepConsumer.hh"
+#include "FPSimulation.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace FPBench {
+
+  const long kSeed = 12345;
+
+  /// Sequential run manager of the full simulation, quiet and initialized
+  inline G4RunManager* CreateRunManager()
+  {
+    G4RunManager* runManager = new G4RunManager;
+    runManager->SetUserInitialization(new FPDetectorConstruction);
+    runManager->SetUserInitialization(FPSimulation::CreatePhysicsList());
+    runManager->SetUserInitialization(new FPActionInitialization());
+
+    G4UImanager* UImanager = G4UImanager::GetUIpointer();
+    UImanager->ApplyCommand("/control/verbose 0");
+    UImanager->ApplyCommand("/run/verbose 0");
+    UImanager->ApplyCommand("/run/printProgress 0");
+    UImanager->ApplyCommand("/run/initialize");
+    return runManager;
+  }
+
+  /// Optical photon steps into the histograms set, none while unset
+  template <class Histograms>
+  class HistogramConsumer : public FPStepConsumer
+  {
+  public:
+    HistogramConsumer() : FPStepConsumer(true, false, false), fHistograms(nullptr) {}
+
+    void SetHistograms(Histograms* histograms) { fHistograms = histograms; }
+    virtual G4bool IsActive() const { return fHistograms != nullptr; }
+
+  protected:
+    Histograms* fHistograms;
+  };
+
+  /// Events per second of nEvents from kSeed, filling the histograms. A
+  /// one-event run before, not histogrammed, absorbs the re-initialization
+  /// of the physics tables after a change of the settings
+  template <class Histograms>
+  G4double TimedRun(G4RunManager* runManager, HistogramConsumer<Histograms>* consumer,
+		    Histograms* histograms, G4int nEvents)
+  {
+    consumer->SetHistograms(nullptr);
+    runManager->BeamOn(1);
+
+    G4Random::setTheSeed(kSeed);
+    consumer->SetHistograms(histograms);
+    auto start = std::chrono::steady_clock::now();
+    runManager->BeamOn(nEvents);
+    auto stop = std::chrono::steady_clock::now();
+    consumer->SetHistograms(nullptr);
+    return nEvents/std::chrono::duration<G4double>(stop - start).count();
+  }
+
+  /// Bin of x in nBins uniform bins over [min, max], clamped to the ends
+  inline G4int Bin(G4double x, G4double min, G4double max, G4int nBins)
+  {
+    G4int bin = G4int((x - min)/(max - min)*nBins);
+    return std::max(std::min(bin, nBins - 1), 0);
+  }
+
+  /// Two-sample chi2 per degree of freedom of histograms of different totals
+  inline G4double Chi2PerNdf(const std::vector<G4double>& a, G4double nA,
+			     const std::vector<G4double>& b, G4double nB)
+  {
+    if (nA <= 0. || nB <= 0.) return 0.;
+    G4double chi2 = 0.;
+    G4int ndf = -1;
+    for (std::size_t i = 0; i < a.size(); i++) {
+      if (a[i] + b[i] <= 0.) continue;
+      G4double d = a[i]*std::sqrt(nB/nA) - b[i]*std::sqrt(nA/nB);
+      chi2 += d*d/(a[i] + b[i]);
+      ndf++;
+    }
+    return (ndf > 0) ? chi2/ndf : 0.;
+  }
+
+}
+
+#endif
@@ -0,0 +1,167 @@
+/// October 19, 2026: Validation and benchmark of the fast boundary process.
+///
+///    1. The tabulated Fresnel transmissions of every pair of indices of the
+///       panel (both directions) against the exact formulas, over random
+///       incidence angles: largest difference for each polarization.
+///    2. The full simulation (sequential run manager, default primary
+///       generator) with the stock boundary process, then with the fast
+///       path (/FP/optical/fastBoundary), from the same seed. At each
+///       boundary step the cosine of the angle between the directions
+///       before and after is histogrammed, for the reflections (Fresnel and
+///       total internal) and for the refractions. Printed for each: the
+///       throughput, the numbers of reflections and refractions, and the
+///       chi2/ndf of the two angular distributions of the fast path against
+///       those of the stock process. The bench fails if either process
+///       gives no reflection or no refraction.
+///
+///    Usage: boundaryBench [nEvents]     (default 100)
+
+#include "G4UImanager.hh"
+#include "G4EventManager.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4Step.hh"
+
+#include "FPSteppingAction.hh"
+#include "FPOpBoundaryProcess.hh"
+#include "FPBench.hh"
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <vector>
+
+namespace {
+
+  const G4int kAngleBins = 200;
+
+  struct AngularDistributions {
+    std::vector<G4double> reflected = std::vector<G4double>(kAngleBins, 0.);
+    std::vector<G4double> refracted = std::vector<G4double>(kAngleBins, 0.);
+    G4double nReflected = 0.;
+    G4double nRefracted = 0.;
+  };
+
+  // Deflection at the boundary steps of the optical photons
+  class BoundaryAngleConsumer : public FPBench::HistogramConsumer<AngularDistributions>
+  {
+  public:
+    BoundaryAngleConsumer(const G4OpBoundaryProcess* boundary) : fBoundary(boundary) {}
+
+    virtual void ProcessStep(const G4Step* step, const G4LogicalVolume*)
+    {
+      // The boundary process is forced: the transportation limits the step
+      if (step->GetPostStepPoint()->GetStepStatus() != fGeomBoundary) return;
+
+      G4OpBoundaryProcessStatus status = fBoundary->GetStatus();
+      G4bool reflected = (status == FresnelReflection || status == TotalInternalReflection);
+      if (!reflected && status != FresnelRefraction) return;
+
+      G4double cosine = step->GetPreStepPoint()->GetMomentumDirection()
+	* step->GetPostStepPoint()->GetMomentumDirection();
+      G4int bin = FPBench::Bin(cosine, -1., 1., kAngleBins);
+      if (reflected) {
+	fHistograms->reflected[bin]++;
+	fHistograms->nReflected++;
+      } else {
+	fHistograms->refracted[bin]++;
+	fHistograms->nRefracted++;
+      }
+    }
+
+  private:
+    const G4OpBoundaryProcess* fBoundary;
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  G4int nEvents = (argc > 1) ? std::atoi(argv[1]) : 100;
+  G4Random::setTheEngine(new CLHEP::RanecuEngine);
+
+  // 1. Tables against the exact transmissions
+  const G4double indices[] = { 1.58, 1.57, 1.49, 1.60, 1.0 };
+  G4cout << G4endl << "Fresnel tables (" << FPOpBoundaryProcess::FresnelTable::kBins
+	 << " bins), largest difference to the exact transmission" << G4endl
+	 << "     n1     n2        s           p" << G4endl;
+  G4Random::setTheSeed(FPBench::kSeed);
+  for (G4double n1 : indices) {
+    for (G4double n2 : indices) {
+      if (n1 == n2) continue;
+      FPOpBoundaryProcess::FresnelTable table(n1, n2);
+      G4double maxS = 0., maxP = 0.;
+      for (G4int i = 0; i < 100000; i++) {
+	G4double cost1 = G4UniformRand();
+	G4double transS, transP;
+	FPOpBoundaryProcess::FresnelTable::Transmission(n1, n2, cost1, transS, transP);
+	maxS = std::max(maxS, std::abs(table.GetTransmission(cost1, 1.) - transS));
+	maxP = std::max(maxP, std::abs(table.GetTransmission(cost1, 0.) - transP));
+      }
+      G4cout << "   " << std::setw(5) << n1 << "  " << std::setw(5) << n2
+	     << std::setw(12) << std::setprecision(3) << maxS
+	     << std::setw(12) << maxP << G4endl;
+    }
+  }
+
+  // 2. Stock process against the fast path
+  G4RunManager* runManager = FPBench::CreateRunManager();
+  G4UImanager* UImanager = G4UImanager::GetUIpointer();
+
+  const G4OpBoundaryProcess* boundary = nullptr;
+  G4ProcessVector* processes = G4OpticalPhoton::Definition()->GetProcessManager()->GetProcessList();
+  for (std::size_t i = 0; i < processes->size() && !boundary; i++) {
+    boundary = dynamic_cast<const G4OpBoundaryProcess*>((*processes)[i]);
+  }
+  auto stepping = dynamic_cast<FPSteppingAction*>(
+    G4EventManager::GetEventManager()->GetUserSteppingAction());
+  if (!boundary || !stepping) {
+    G4cerr << "boundaryBench: no boundary process or stepping action" << G4endl;
+    return 1;
+  }
+  BoundaryAngleConsumer* consumer = new BoundaryAngleConsumer(boundary);
+  stepping->RegisterConsumer(consumer);
+
+  const char* names[] = { "stock", "fast" };
+  AngularDistributions distributions[2];
+  G4double eventRates[2];
+  for (G4int fast = 0; fast < 2; fast++) {
+    UImanager->ApplyCommand(fast ? "/FP/optical/fastBoundary true" : "/FP/optical/fastBoundary false");
+    eventRates[fast] = FPBench::TimedRun(runManager, consumer, &distributions[fast], nEvents);
+  }
+
+  G4cout << G4endl << "Boundary process, " << nEvents << " events each" << G4endl
+	 << "   process    events/s   reflections   refractions   chi2/ndf refl.   chi2/ndf refr." << G4endl;
+  for (G4int fast = 0; fast < 2; fast++) {
+    const AngularDistributions& d = distributions[fast];
+    G4cout << "   " << std::left << std::setw(8) << names[fast] << std::right
+	   << std::setw(11) << std::setprecision(4) << eventRates[fast]
+	   << std::setw(14) << G4long(d.nReflected) << std::setw(14) << G4long(d.nRefracted);
+    if (fast) {
+      G4cout << std::setw(17) << std::setprecision(3)
+	     << FPBench::Chi2PerNdf(distributions[0].reflected, distributions[0].nReflected,
+				    d.reflected, d.nReflected)
+	     << std::setw(17)
+	     << FPBench::Chi2PerNdf(distributions[0].refracted, distributions[0].nRefracted,
+				    d.refracted, d.nRefracted);
+    }
+    G4cout << G4endl;
+  }
+
+  delete runManager;
+
+  // An empty histogram would compare as a perfect agreement
+  for (G4int fast = 0; fast < 2; fast++) {
+    if (distributions[fast].nReflected <= 0. || distributions[fast].nRefracted <= 0.) {
+      G4cerr << "boundaryBench: no " << (distributions[fast].nReflected <= 0. ? "reflection" : "refraction")
+	     << " recorded with the " << names[fast] << " process" << G4endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
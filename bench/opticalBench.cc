@@ -0,0 +1,113 @@
+/// October 19, 2026: Benchmark of the optical physics settings.
+///
+///    Runs the full simulation (sequential run manager, default primary
+///    generator) once per setting of /FP/optical/, each one alone from the
+///    GEANT4 defaults, with the same random seed, and prints for each
+///      - the throughput in events per second,
+///      - the peak number of tracks in the stacks and an estimate of the
+///        memory it holds (G4Track + G4DynamicParticle per stacked track).
+///    A one-event run before each measurement absorbs the re-initialization
+///    of the physics tables.
+///
+///    Usage: opticalBench [nEvents]     (default 100)
+
+#include "G4RunManager.hh"
+#include "G4UImanager.hh"
+#include "G4EventManager.hh"
+#include "G4Track.hh"
+#include "G4DynamicParticle.hh"
+#include "Randomize.hh"
+
+#include "FPDetectorConstruction.hh"
+#include "FPActionInitialization.hh"
+#include "FPStackingAction.hh"
+#include "FPSimulation.hh"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <vector>
+
+namespace {
+
+  struct Setting {
+    const char* name;
+    std::vector<const char*> commands;
+  };
+
+  // Back to the GEANT4 defaults
+  const std::vector<const char*> kDefaults = {
+    "/FP/optical/trackSecondariesFirst true",
+    "/FP/optical/maxPhotonsPerStep 100",
+    "/FP/optical/maxBetaChange 10",
+    "/FP/optical/yieldFactor 1",
+    "/FP/optical/activate OpRayleigh true",
+    "/FP/optical/batchedScintillation false"
+  };
+
+  const std::vector<Setting> kSettings = {
+    { "defaults",                   { } },
+    { "photons stacked (no first)", { "/FP/optical/trackSecondariesFirst false" } },
+    { "20 Cerenkov photons/step",   { "/FP/optical/maxPhotonsPerStep 20" } },
+    { "2 % beta change/step",       { "/FP/optical/maxBetaChange 2" } },
+    { "scintillation yield x 0.5",  { "/FP/optical/yieldFactor 0.5" } },
+    { "no Rayleigh scattering",     { "/FP/optical/activate OpRayleigh false" } },
+    { "batched scintillation",      { "/FP/optical/batchedScintillation true" } }
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  G4int nEvents = (argc > 1) ? std::atoi(argv[1]) : 100;
+
+  G4Random::setTheEngine(new CLHEP::RanecuEngine);
+  G4RunManager* runManager = new G4RunManager;
+  runManager->SetUserInitialization(new FPDetectorConstruction);
+
+  runManager->SetUserInitialization(FPSimulation::CreatePhysicsList());
+  runManager->SetUserInitialization(new FPActionInitialization());
+
+  G4UImanager* UImanager = G4UImanager::GetUIpointer();
+  UImanager->ApplyCommand("/control/verbose 0");
+  UImanager->ApplyCommand("/run/verbose 0");
+  UImanager->ApplyCommand("/run/printProgress 0");
+  UImanager->ApplyCommand("/run/initialize");
+
+  auto stacking = dynamic_cast<FPStackingAction*>(
+    G4EventManager::GetEventManager()->GetUserStackingAction());
+  const G4double bytesPerTrack = sizeof(G4Track) + sizeof(G4DynamicParticle);
+
+  std::vector<G4double> eventRates;
+  std::vector<G4int> peaks;
+  for (const Setting& setting : kSettings) {
+    for (const char* command : kDefaults) UImanager->ApplyCommand(command);
+    for (const char* command : setting.commands) UImanager->ApplyCommand(command);
+    runManager->BeamOn(1);
+
+    G4Random::setTheSeed(12345);
+    if (stacking) stacking->ResetPeakStackedTracks();
+    auto start = std::chrono::steady_clock::now();
+    runManager->BeamOn(nEvents);
+    auto stop = std::chrono::steady_clock::now();
+
+    eventRates.push_back(nEvents/std::chrono::duration<G4double>(stop - start).count());
+    peaks.push_back(stacking ? stacking->GetPeakStackedTracks() : 0);
+  }
+
+  G4cout << G4endl << "Optical physics settings, " << nEvents << " events each" << G4endl
+	 << "   setting                       events/s   peak stacked tracks (kB)" << G4endl;
+  for (std::size_t i = 0; i < kSettings.size(); i++) {
+    G4cout << "   " << std::left << std::setw(28) << kSettings[i].name << std::right
+	   << std::setw(10) << std::setprecision(4) << eventRates[i]
+	   << std::setw(14) << peaks[i]
+	   << " (" << std::setprecision(3) << peaks[i]*bytesPerTrack/1024. << ")" << G4endl;
+  }
+
+  delete runManager;
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,171 @@
+/// October 19, 2026: Validation and benchmark of the batched scintillation.
+///
+///    1. The inverse-CDF tables of FPScintillation against the inversion of
+///       the spectrum integral done by G4Scintillation at each photon, for
+///       every scintillating material, over random uniform numbers: largest
+///       difference of the photon energy, and of the cumulative
+///       distribution at that energy (bounded by 1/kInverseBins).
+///    2. The full simulation (sequential run manager, default primary
+///       generator) with the stock process, then with the batched
+///       generation (/FP/optical/batchedScintillation), from the same seed.
+///       The energies of the scintillation photons are histogrammed at
+///       their first step. Printed for each: the throughput, the number of
+///       photons, their mean energy and the chi2/ndf of the energy
+///       distribution of the batched generation against the stock one.
+///
+///    Usage: scintillationBench [nEvents]     (default 100)
+
+#include "G4UImanager.hh"
+#include "G4EventManager.hh"
+#include "G4MuonMinus.hh"
+#include "G4Material.hh"
+#include "G4PhysicsTable.hh"
+#include "G4PhysicsFreeVector.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4VProcess.hh"
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4SystemOfUnits.hh"
+
+#include "FPSteppingAction.hh"
+#include "FPScintillation.hh"
+#include "FPBench.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <vector>
+
+namespace {
+
+  const G4int kEnergyBins = 200;
+
+  struct EnergyDistribution {
+    std::vector<G4double> counts = std::vector<G4double>(kEnergyBins, 0.);
+    G4double nPhotons = 0.;
+    G4double sumEnergy = 0.;
+  };
+
+  // Energy of the scintillation photons at their first step
+  class PhotonEnergyConsumer : public FPBench::HistogramConsumer<EnergyDistribution>
+  {
+  public:
+    PhotonEnergyConsumer(G4double minEnergy, G4double maxEnergy)
+      : fMinEnergy(minEnergy), fMaxEnergy(maxEnergy) {}
+
+    virtual void ProcessStep(const G4Step* step, const G4LogicalVolume*)
+    {
+      const G4Track* track = step->GetTrack();
+      if (track->GetCurrentStepNumber() != 1) return;
+      const G4VProcess* creator = track->GetCreatorProcess();
+      if (!creator || creator->GetProcessName() != "Scintillation") return;
+
+      G4double energy = step->GetPreStepPoint()->GetKineticEnergy();
+      fHistograms->counts[FPBench::Bin(energy, fMinEnergy, fMaxEnergy, kEnergyBins)]++;
+      fHistograms->nPhotons++;
+      fHistograms->sumEnergy += energy;
+    }
+
+  private:
+    G4double fMinEnergy, fMaxEnergy;
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  G4int nEvents = (argc > 1) ? std::atoi(argv[1]) : 100;
+  G4Random::setTheEngine(new CLHEP::RanecuEngine);
+
+  G4RunManager* runManager = FPBench::CreateRunManager();
+  G4UImanager* UImanager = G4UImanager::GetUIpointer();
+
+  const FPScintillation* scintillation = nullptr;
+  G4ProcessVector* processes = G4MuonMinus::Definition()->GetProcessManager()->GetProcessList();
+  for (std::size_t i = 0; i < processes->size() && !scintillation; i++) {
+    scintillation = dynamic_cast<const FPScintillation*>((*processes)[i]);
+  }
+  auto stepping = dynamic_cast<FPSteppingAction*>(
+    G4EventManager::GetEventManager()->GetUserSteppingAction());
+  if (!scintillation || !stepping) {
+    G4cerr << "scintillationBench: no batched scintillation process or stepping action" << G4endl;
+    return 1;
+  }
+
+  // The physics tables are built by the first run
+  UImanager->ApplyCommand("/FP/optical/batchedScintillation false");
+  runManager->BeamOn(1);
+
+  // 1. Tables against the inversion of G4Scintillation
+  G4PhysicsTable* integrals = scintillation->GetIntegralTable1();
+  const G4MaterialTable* materials = G4Material::GetMaterialTable();
+  G4double minEnergy = DBL_MAX, maxEnergy = 0.;
+  G4cout << G4endl << "Inverse-CDF tables (" << FPScintillation::kInverseBins
+	 << " steps), largest difference to the inversion of G4Scintillation" << G4endl
+	 << "   material          energy (eV)     CDF" << G4endl;
+  G4Random::setTheSeed(FPBench::kSeed);
+  for (std::size_t i = 0; integrals && i < integrals->entries(); i++) {
+    const std::vector<G4double>* inverse = scintillation->GetInverseCDF(i);
+    if (!inverse || inverse->empty()) continue;
+    auto integral = static_cast<G4PhysicsFreeVector*>((*integrals)(i));
+    G4double total = integral->GetMaxValue();
+    minEnergy = std::min(minEnergy, inverse->front());
+    maxEnergy = std::max(maxEnergy, inverse->back());
+
+    G4double maxEnergyDiff = 0., maxCDFDiff = 0.;
+    for (G4int k = 0; k < 1000000; k++) {
+      G4double r = G4UniformRand();
+      G4double exact = integral->GetEnergy(r*total);
+      G4double u = r*FPScintillation::kInverseBins;
+      G4int j = std::min(G4int(u), FPScintillation::kInverseBins - 1);
+      G4double table = (*inverse)[j] + (u - j)*((*inverse)[j + 1] - (*inverse)[j]);
+      maxEnergyDiff = std::max(maxEnergyDiff, std::abs(table - exact));
+      maxCDFDiff = std::max(maxCDFDiff, std::abs(integral->Value(table)/total - r));
+    }
+    G4cout << "   " << std::left << std::setw(16) << (*materials)[i]->GetName() << std::right
+	   << std::setw(12) << std::setprecision(3) << maxEnergyDiff/eV
+	   << std::setw(12) << maxCDFDiff << G4endl;
+  }
+  if (maxEnergy <= minEnergy) {
+    G4cerr << "scintillationBench: no scintillating material" << G4endl;
+    return 1;
+  }
+
+  // 2. Stock process against the batched generation
+  PhotonEnergyConsumer* consumer = new PhotonEnergyConsumer(minEnergy, maxEnergy);
+  stepping->RegisterConsumer(consumer);
+
+  const char* names[] = { "stock", "batched" };
+  EnergyDistribution distributions[2];
+  G4double eventRates[2];
+  for (G4int batched = 0; batched < 2; batched++) {
+    UImanager->ApplyCommand(batched ? "/FP/optical/batchedScintillation true"
+			    : "/FP/optical/batchedScintillation false");
+    eventRates[batched] = FPBench::TimedRun(runManager, consumer, &distributions[batched], nEvents);
+  }
+
+  G4cout << G4endl << "Scintillation, " << nEvents << " events each" << G4endl
+	 << "   process    events/s       photons   mean energy (eV)   chi2/ndf energy" << G4endl;
+  for (G4int batched = 0; batched < 2; batched++) {
+    const EnergyDistribution& d = distributions[batched];
+    G4cout << "   " << std::left << std::setw(8) << names[batched] << std::right
+	   << std::setw(11) << std::setprecision(4) << eventRates[batched]
+	   << std::setw(14) << G4long(d.nPhotons)
+	   << std::setw(19) << (d.nPhotons > 0. ? d.sumEnergy/d.nPhotons/eV : 0.);
+    if (batched) {
+      G4cout << std::setw(18) << std::setprecision(3)
+	     << FPBench::Chi2PerNdf(distributions[0].counts, distributions[0].nPhotons,
+				    d.counts, d.nPhotons);
+    }
+    G4cout << G4endl;
+  }
+
+  delete runManager;
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,140 @@
+/// October 19, 2026: Microbenchmark of the stepping action cost per step.
+///
+///    Steps of optical photons and muons inside a panel volume are handed
+///    repeatedly to
+///      - the stepping action as it was before the dispatcher (touchable
+///        volume lookup on every step, then the energy deposit check), and
+///      - FPSteppingAction with the default consumers,
+///      - the same with a muon consumer registered for the panel volume only.
+///    The tracking itself is not run: this isolates the per-call overhead.
+///
+///    Usage: stepBench [nSteps] [opticalFraction]     (default 10000000 0.99)
+
+#include "FPSteppingAction.hh"
+#include "FPEventAction.hh"
+
+#include "G4NistManager.hh"
+#include "G4Box.hh"
+#include "G4LogicalVolume.hh"
+#include "G4PVPlacement.hh"
+#include "G4Navigator.hh"
+#include "G4TouchableHistory.hh"
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4DynamicParticle.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4MuonMinus.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <chrono>
+#include <cstdlib>
+
+namespace {
+
+  // The body of FPSteppingAction::UserSteppingAction before October 2026
+  void LegacySteppingAction(const G4Step* step, FPEventAction* eventAction)
+  {
+    auto volume = step->GetPreStepPoint()->GetTouchableHandle()->GetVolume()->GetLogicalVolume();
+    (void) volume;
+    auto edep = step->GetTotalEnergyDeposit();
+    if (edep > 0.) eventAction->AddELoss(edep);
+  }
+
+  G4Step* MakeStep(G4ParticleDefinition* particle, G4double energy, G4double edep,
+		   G4Navigator& navigator)
+  {
+    G4ThreeVector position(1.*cm, 2.*cm, 0.);
+    navigator.LocateGlobalPointAndSetup(position);
+
+    auto dynamicParticle = new G4DynamicParticle(particle, G4ThreeVector(0., 0., 1.), energy);
+    auto track = new G4Track(dynamicParticle, 0., position);
+    track->SetTouchableHandle(G4TouchableHandle(navigator.CreateTouchableHistory()));
+
+    auto step = new G4Step();
+    step->InitializeStep(track);
+    step->SetTotalEnergyDeposit(edep);
+    track->SetStep(step);
+    return step;
+  }
+
+  template <class F>
+  G4double TimePerStep(F&& body, G4Step* const* steps, std::size_t nSteps)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < nSteps; i++) body(steps[i & 1023]);
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<G4double, std::nano>(stop - start).count()/nSteps;
+  }
+
+  // Counts the muon steps of one volume (volume-keyed registration)
+  class VolumeCounter : public FPStepConsumer
+  {
+  public:
+    VolumeCounter(const G4LogicalVolume* volume)
+      : FPStepConsumer(false, true, false), fVolume(volume), fSteps(0) {}
+
+    virtual std::vector<const G4LogicalVolume*> GetVolumes() const { return { fVolume }; }
+    virtual void ProcessStep(const G4Step*, const G4LogicalVolume*) { fSteps++; }
+
+  private:
+    const G4LogicalVolume* fVolume;
+    std::size_t fSteps;
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  std::size_t nSteps = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  G4double opticalFraction = (argc > 2) ? std::atof(argv[2]) : 0.99;
+
+  // Minimal geometry: a scintillator panel in air
+  G4NistManager* nist = G4NistManager::Instance();
+  auto worldLV = new G4LogicalVolume(new G4Box("World", 15*cm, 15*cm, 2.5*cm),
+				     nist->FindOrBuildMaterial("G4_AIR"), "WorldLV");
+  auto worldPV = new G4PVPlacement(0, G4ThreeVector(), worldLV, "WorldPV", 0, false, 0);
+  auto panelLV = new G4LogicalVolume(new G4Box("Panel", 10*cm, 10*cm, 0.5*cm),
+				     nist->FindOrBuildMaterial("G4_PLASTIC_SC_VINYLTOLUENE"), "PanelLV");
+  new G4PVPlacement(0, G4ThreeVector(), panelLV, "PanelPV", worldLV, false, 0);
+
+  G4Navigator navigator;
+  navigator.SetWorldVolume(worldPV);
+
+  // A ring of pre-built steps with the requested optical photon fraction
+  G4Step* steps[1024];
+  for (std::size_t i = 0; i < 1024; i++) {
+    G4bool optical = (i + 0.5) < opticalFraction*1024;
+    steps[i] = optical
+      ? MakeStep(G4OpticalPhoton::Definition(), 2.5*eV, 0., navigator)
+      : MakeStep(G4MuonMinus::Definition(), 4.*GeV, 0.2*MeV, navigator);
+  }
+
+  FPEventAction eventAction(nullptr);
+  eventAction.BeginOfEventAction(nullptr);
+  FPSteppingAction steppingAction(&eventAction);
+
+  // Warm up, then measure
+  TimePerStep([&](G4Step* s) { LegacySteppingAction(s, &eventAction); }, steps, nSteps/10);
+  G4double before = TimePerStep([&](G4Step* s) { LegacySteppingAction(s, &eventAction); },
+				steps, nSteps);
+  G4double after = TimePerStep([&](G4Step* s) { steppingAction.UserSteppingAction(s); },
+			       steps, nSteps);
+
+  FPSteppingAction volumeAction(&eventAction);
+  volumeAction.RegisterConsumer(new VolumeCounter(panelLV));
+  volumeAction.UpdateConsumers();
+  G4double byVolume = TimePerStep([&](G4Step* s) { volumeAction.UserSteppingAction(s); },
+				  steps, nSteps);
+
+  G4cout << "Stepping action cost, " << nSteps << " steps, optical photon fraction "
+	 << opticalFraction << G4endl
+	 << "   before (volume lookup on every step) : " << before << " ns/step" << G4endl
+	 << "   after  (per-particle dispatch)       : " << after  << " ns/step" << G4endl
+	 << "   after, with a panel-only consumer    : " << byVolume << " ns/step" << G4endl;
+
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -21,13 +21,33 @@
 ///    Updated code the GEANT4 version 11.1
 ///    Updated the configuration of optical physics process call.
 ///
+/// October 19, 2026:
+///    Registered G4FastSimulationPhysics for optical photons (WLS fiber fast model).
+///
+/// October 19, 2026:
+///    The optical physics settings (photons tracked first, Cerenkov photons and beta
+///    change per step, scintillation yield factor, process activation) are set with
+///    the /FP/optical/ commands (see FPOpticalControl) instead of being commented out.
+///
+/// October 19, 2026:
+///    -j nProcesses: sequential run manager, geometry and optical variants run in
+///    processes forked after the initialization (see FPForkDriver).
+///
+/// October 19, 2026:
+///    FPMTRunManager: event batches sized from the measured event cost, and
+///    per-thread load report (see /FP/mt/).
+///
+/// October 19, 2026:
+///    The physics list is built by FPSimulation::CreatePhysicsList(), shared with
+///    the in-process API of the fiberPanelCore library.
+///
 
 /// \file fiberPanelMain.cc
 
 #include "G4Types.hh"
 
 #ifdef G4MULTITHREADED
-#include "G4MTRunManager.hh"
+#include "FPMTRunManager.hh"
 #else
 #include "G4RunManager.hh"
 #endif
@@ -38,8 +58,8 @@
 
 #include "FPDetectorConstruction.hh"
 #include "FTFP_BERT.hh"
-#include "G4PhysListFactory.hh"
-#include "G4OpticalPhysics.hh"
+#include "FPForkDriver.hh"
+#include "FPSimulation.hh"
 //#include "FPPhysicsList.hh"
 
 #include "FPActionInitialization.hh"
@@ -64,9 +84,11 @@ int main(int argc,char** argv)
   namespace {
     void PrintUsage() {
       G4cerr << " Usage: " << G4endl;
-      G4cerr << " LoopPanel [-m macro ] [-u UIsession] [-t nThreads]" << G4endl;
+      G4cerr << " LoopPanel [-m macro ] [-u UIsession] [-t nThreads] [-j nProcesses]" << G4endl;
       G4cerr << "   note: -t option is available only for multi-threaded mode."
 	     << G4endl;
+      G4cerr << "   -j: variants in forked processes (/FP/fork/), sequential in each."
+	     << G4endl;
     }
   }
 
@@ -76,19 +98,23 @@ int main(int argc,char** argv)
 {
   // Evaluate arguments
   //
-  if ( argc > 7 ) {
+  if ( argc > 9 ) {
     PrintUsage();
     return 1;
   }
   
   G4String macro;
   G4String session;
+  G4int nProcesses = 0;
 #ifdef G4MULTITHREADED
   G4int nThreads = 0;
 #endif
   for ( G4int i=1; i<argc; i=i+2 ) {
     if      ( G4String(argv[i]) == "-m" ) macro = argv[i+1];
     else if ( G4String(argv[i]) == "-u" ) session = argv[i+1];
+    else if ( G4String(argv[i]) == "-j" ) {
+      nProcesses = G4UIcommand::ConvertToInt(argv[i+1]);
+    }
 #ifdef G4MULTITHREADED
     else if ( G4String(argv[i]) == "-t" ) {
       nThreads = G4UIcommand::ConvertToInt(argv[i+1]);
@@ -114,14 +140,24 @@ int main(int argc,char** argv)
   // Construct the default run manager
   //
 #ifdef G4MULTITHREADED
-  G4MTRunManager* runManager = new G4MTRunManager;
-  if ( nThreads > 0 ) { 
-    runManager->SetNumberOfThreads(nThreads);
+  G4RunManager* runManager = nullptr;
+  if ( nProcesses > 0 ) {
+    // Processes are forked after the initialization: no threads
+    runManager = new G4RunManager;
+  } else {
+    FPMTRunManager* mtRunManager = new FPMTRunManager;
+    if ( nThreads > 0 ) { 
+      mtRunManager->SetNumberOfThreads(nThreads);
+    }
+    runManager = mtRunManager;
   }
 #else
   G4RunManager* runManager = new G4RunManager;
 #endif
 
+  // Variants in forked processes (/FP/fork/)
+  FPForkDriver::Instance()->SetMaxProcesses(nProcesses);
+
   // Set mandatory initialization classes
   //
   runManager->SetUserInitialization(new FPDetectorConstruction);
@@ -129,45 +165,8 @@ int main(int argc,char** argv)
   //  The following is from the Example 3a. We don't use it.
   //  runManager->SetUserInitialization(new FPPhysicsList);
 
-  // Need to add code for activating optical physics processes
-  // We simply took the code from the loopPanel processes configuration 
-  G4PhysListFactory factory;
-  G4VModularPhysicsList* phys = NULL;
-  G4String physName = "";
-  char* path = getenv("PHYSLIST");
-  if (path) {
-      physName = G4String(path);
-  } else {
-      physName = "FTFP_BERT"; // default
-  }
-  // reference PhysicsList via its name
-  if (factory.IsReferencePhysList(physName)) {
-      phys = factory.GetReferencePhysList(physName);
-  }
-  //
-  // Now add and configure optical physics
-  //
-  G4OpticalPhysics* opticalPhysics = new G4OpticalPhysics();
-  /* These were commented out on 7/17/2024. 
-  //opticalPhysics->Configure(kCerenkov, true);
-  //opticalPhysics->SetCerenkovStackPhotons(false);
-  opticalPhysics->Configure(kScintillation, true);  
-  opticalPhysics->Configure(kAbsorption, true); 
-  opticalPhysics->Configure(kBoundary, true);      
-  opticalPhysics->Configure(kWLS, true);
-
-  // Set control parameters for scintillation
-  // Followed from: 
-  // https://indico.cern.ch/event/789510/contributions/3279418/attachments/1818134/2972494/AH_OpticalPhotons_slides.pdf
-  opticalPhysics->SetScintillationYieldFactor(1.0);
-  opticalPhysics->SetScintillationExcitationRatio(0.0);
-
-  opticalPhysics->SetMaxNumPhotonsPerStep(100);
-  opticalPhysics->SetMaxBetaChangePerStep(10.0);
-  */
-  
-  phys->RegisterPhysics(opticalPhysics);
-  phys->DumpList();
+  // Reference physics list with the optical and the fast simulation physics
+  G4VModularPhysicsList* phys = FPSimulation::CreatePhysicsList();
   
   //auto physicsList = new FTFP_BERT;
   runManager->SetUserInitialization(phys);
@@ -191,8 +190,7 @@ int main(int argc,char** argv)
   if ( ! ui ) {
     // batch mode
     G4String command = "/control/execute ";
-    G4String fileName = argv[1];
-    UImanager->ApplyCommand(command+fileName);
+    UImanager->ApplyCommand(command+macro);
   }
   else {
     // interactive mode
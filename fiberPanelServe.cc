@@ -0,0 +1,112 @@
+/// October 19, 2026: Long-lived simulation driver.
+///
+///    Initializes the simulation once, then reads requests from stdin, one per
+///    line, and answers each on stdout with one line:
+///
+///      /any/ui/command ...    -> ok | error <status>
+///      run <nEvents>          -> the results of the run, as a JSON object
+///      quit                   -> exit (also at the end of the input)
+///
+///    Empty lines and lines starting with '#' are ignored. The output of the
+///    simulation itself goes to stderr, so that stdout carries the answers
+///    only. Optimization loops keep one driver and send it the geometry and
+///    source of each trial, without paying the start-up again.
+///
+///    Usage: fiberPanelServe [-t nThreads]     (default: sequential)
+
+#include "FPSimulation.hh"
+
+#include "G4UIcommand.hh"
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+namespace {
+
+  void WriteHistogram(std::ostream& out, const FPHistogram& histogram)
+  {
+    out << "{\"name\":\"" << histogram.name << "\",\"xmin\":" << histogram.xmin
+	<< ",\"xmax\":" << histogram.xmax << ",\"counts\":[";
+    for (std::size_t i = 0; i < histogram.counts.size(); i++) {
+      out << (i ? "," : "") << histogram.counts[i];
+    }
+    out << "]}";
+  }
+
+  void WriteResults(std::ostream& out, const FPRunResults& results)
+  {
+    out << std::setprecision(10)
+	<< "{\"events\":" << results.nEvents
+	<< ",\"eventsWithPhotons\":" << results.nEventsWithPhotons
+	<< ",\"lightYield\":" << results.lightYield
+	<< ",\"lightYieldError\":" << results.lightYieldError
+	<< ",\"lightYieldRMS\":" << results.lightYieldRMS
+	<< ",\"eLossMeV\":" << results.eLoss
+	<< ",\"eLossErrorMeV\":" << results.eLossError
+	<< ",\"seconds\":" << results.seconds
+	<< ",\"histograms\":[";
+    for (std::size_t i = 0; i < results.histograms.size(); i++) {
+      if (i) out << ",";
+      WriteHistogram(out, results.histograms[i]);
+    }
+    out << "]}";
+  }
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  G4int nThreads = 0;
+  for (G4int i = 1; i + 1 < argc; i += 2) {
+    if (G4String(argv[i]) == "-t") nThreads = G4UIcommand::ConvertToInt(argv[i+1]);
+  }
+
+  // Answers on the original stdout; everything else (G4cout of all the
+  // threads included) on stderr
+  FILE* answers = fdopen(dup(STDOUT_FILENO), "w");
+  dup2(STDERR_FILENO, STDOUT_FILENO);
+
+  FPSimulation simulation(nThreads);
+  simulation.Initialize();
+
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    std::istringstream request(line);
+    std::string keyword;
+    if (!(request >> keyword) || keyword[0] == '#') continue;
+
+    std::ostringstream answer;
+    if (keyword == "quit") {
+      break;
+    } else if (keyword == "run") {
+      G4int nEvents = 0;
+      if (request >> nEvents && nEvents > 0) {
+	WriteResults(answer, simulation.Run(nEvents));
+      } else {
+	answer << "error bad number of events";
+      }
+    } else if (keyword[0] == '/') {
+      G4int status = simulation.ApplyCommand(line);
+      if (status == 0) answer << "ok";
+      else answer << "error " << status;
+    } else {
+      answer << "error unknown request " << keyword;
+    }
+
+    std::cout.flush();
+    std::fprintf(answers, "%s\n", answer.str().c_str());
+    std::fflush(answers);
+  }
+
+  std::fclose(answers);
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
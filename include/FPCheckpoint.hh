@@ -0,0 +1,140 @@
+/// October 19, 2026: Checkpoint and resume of long runs.
+///
+///    Every event is fully determined by its random seeds: in multi-threaded
+///    mode the master draws the seeds of all events from its engine at the
+///    beginning of the run. A checkpoint therefore holds
+///      - the master engine state at the beginning of the run (base file),
+///      - per worker (shard files): the summary of each completed event
+///        (FPEventRecord), the state of the worker accumulables that are not
+///        rebuilt from those records, and the worker engine state,
+///    each file being written to a temporary name and renamed, so that a
+///    checkpoint on disk is always complete.
+///
+///    On resume the master restores its engine, so the events get the seeds
+///    of the interrupted run; completed events are skipped by the primary
+///    generator and their summaries and accumulable states are added back
+///    into the master (the states at the end of the run, after the last
+///    shard), which gives the same output as an uninterrupted run.
+///    In sequential mode the engine state of the shard is restored at the
+///    first event not completed.
+///
+///    Files, in the checkpoint directory, for run N and generation G (one
+///    generation per resumed job):
+///      runN.base          master engine state + data of the earlier generations
+///      runN.gG.tT.shard   data of worker thread T of generation G
+///
+///    One instance is shared by all threads. Commands under /FP/checkpoint/.
+
+#ifndef FPCheckpoint_h
+#define FPCheckpoint_h 1
+
+#include "globals.hh"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+class FPCheckpointMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// Summary of one event, enough to refill the run histograms and statistics
+
+struct FPEventRecord
+{
+  /// nPhotons of an event cut short by the coincidence trigger, whose
+  /// photons were not all tracked: no light yield
+  static const G4int kPhotonsNotCounted = -1;
+
+  G4int    eventID;
+  G4int    nPhotons;         // detected photons, or kPhotonsNotCounted
+  G4double eLoss;            // energy loss, internal units
+};
+
+/// Data of one worker (or of all the workers of earlier generations)
+
+struct FPCheckpointShard
+{
+  std::vector<FPEventRecord>       records;
+  std::map<G4String, std::string>  states;        // accumulable name -> saved state
+  std::string                      engineState;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPCheckpoint
+{
+public:
+  static FPCheckpoint* Instance();
+  ~FPCheckpoint();
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)               { fEnabled = value; }
+  void SetDirectory(const G4String& dir)      { fDirectory = dir; }
+  void SetInterval(G4double seconds)          { fInterval = seconds; }
+  void SetResume(G4bool value)                { fResume = value; }
+
+  /// Master, beginning of run (before the seeds are drawn): save or restore
+  /// the master engine and load the data of the interrupted run
+  void BeginOfRun(G4int runID);
+
+  /// Data of the interrupted run, to be added into the master
+  const std::vector<FPCheckpointShard>& GetRestoredShards() const { return fRestored; }
+
+  /// Any thread: true if the event was completed before the interruption.
+  /// Thread safe: the set is read-only during the run.
+  G4bool IsCompleted(G4int eventID) const;
+  /// Primary generator: IsCompleted(), and in sequential mode restore the
+  /// engine at the first event to simulate
+  G4bool SkipEvent(G4int eventID);
+
+  /// Any thread, beginning of run: the interval of the shards starts now
+  void BeginOfThreadRun();
+  /// Worker: is it time to write a new shard?
+  G4bool IsDue() const;
+  /// Worker: write the shard of the calling thread
+  void WriteShard(const FPCheckpointShard& shard);
+
+  /// Engine state of the calling thread as a string, and back
+  static std::string SaveEngine();
+  static void RestoreEngine(const std::string& state);
+
+  /// Read the checkpoint of a run: the base file and the shards of its
+  /// generation (also used by fpMerge to collect the results of split jobs).
+  /// Returns false if there is no checkpoint of this run.
+  static G4bool Load(const G4String& directory, G4int runID, G4int& generation,
+		     std::string& masterEngine, std::vector<FPCheckpointShard>& shards);
+  /// IDs of the runs with a checkpoint in the directory, sorted
+  static std::vector<G4int> ListRuns(const G4String& directory);
+
+  static void WriteShardData(std::ostream& out, const FPCheckpointShard& shard);
+  static G4bool ReadShardData(std::istream& in, FPCheckpointShard& shard);
+
+private:
+  FPCheckpoint();
+
+  static G4String BaseFileName(const G4String& directory, G4int runID);
+  static G4String ShardPrefix(G4int runID, G4int generation);
+  static std::vector<G4String> ListFiles(const G4String& directory, const G4String& prefix);
+  void WriteBase(const std::string& masterEngine);
+  static G4bool WriteAtomically(const G4String& fileName, const std::string& data);
+
+  G4bool   fEnabled;
+  G4String fDirectory;
+  G4double fInterval;          // seconds between two shards of a worker
+  G4bool   fResume;
+
+  G4int fRunID;
+  G4int fGeneration;
+  std::vector<FPCheckpointShard> fRestored;
+  std::vector<G4int>             fCompleted;         // sorted event IDs
+  std::string                    fSequentialEngine;  // engine after the last completed event
+  G4bool                         fEngineRestored;
+
+  FPCheckpointMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
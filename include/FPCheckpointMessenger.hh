@@ -0,0 +1,38 @@
+/// October 19, 2026: Checkpoint messenger.
+///
+///    Commands under /FP/checkpoint/.
+
+#ifndef FPCheckpointMessenger_h
+#define FPCheckpointMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPCheckpoint;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithADoubleAndUnit;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPCheckpointMessenger: public G4UImessenger
+{
+public:
+  FPCheckpointMessenger(FPCheckpoint*);
+  ~FPCheckpointMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPCheckpoint*                FPCkpt;
+  G4UIdirectory*                   checkpointDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithAString*          SetDirectoryCmd;
+  G4UIcmdWithADoubleAndUnit*   SetIntervalCmd;
+  G4UIcmdWithABool*            SetResumeCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
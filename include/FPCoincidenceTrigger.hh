@@ -0,0 +1,113 @@
+/// October 19, 2026: Coincidence trigger of the panel stack.
+///
+///    An event is triggered when at least <fold> panels (all of them by
+///    default) have at least <minPhotons> photons on their SiPM. The
+///    stacking action tracks the charged particles first, holding back the
+///    optical photons, then the photons panel by panel, starting with the
+///    panel that has the fewest: as soon as the remaining panels cannot
+///    reach the fold, the outcome is fixed and the photons not yet tracked
+///    are killed. Once the fold is reached the remaining panels are tracked
+///    together, their hits being read out.
+///
+///    The final decision is taken at the end of event from the hits; only
+///    triggered events are digitized and streamed. An event whose photons
+///    were killed by a fixed negative outcome is cut short: its photon
+///    count is not a light yield, and the run statistics leave it out. The
+///    trigger counts are merged as an accumulable and printed by the master.
+///
+///    One instance per thread, owned by the run action. Commands under /FP/trigger/.
+
+#ifndef FPCoincidenceTrigger_h
+#define FPCoincidenceTrigger_h 1
+
+#include "G4VAccumulable.hh"
+#include "SiPMhit.hh"
+#include "globals.hh"
+
+#include <iosfwd>
+#include <vector>
+
+class FPCoincidenceTriggerMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPCoincidenceTrigger : public G4VAccumulable
+{
+public:
+  /// Photons being tracked, besides a panel number
+  enum { kCharged = -1, kAllPanels = -2, kNoPanel = -3 };
+
+  FPCoincidenceTrigger();
+  virtual ~FPCoincidenceTrigger();
+
+  /// The trigger of the calling thread (nullptr before the run action exists)
+  static FPCoincidenceTrigger* Instance() { return fgInstance; }
+
+  // G4VAccumulable
+  virtual void Merge(const G4VAccumulable& other);
+  virtual void Reset();
+
+  /// Number of panels of the geometry (beginning of run)
+  void BeginOfRun();
+  void BeginOfEvent();
+  /// Photons held back during the charged particle stage
+  void AddPhoton(G4int panel) { fPanelPhotons[panel]++; }
+  /// End of a stage: the next panel to track, kAllPanels once triggered,
+  /// kNoPanel once the trigger cannot fire any more
+  G4int NextPanel(const SiPMHitCollection* hits);
+  void AddKilledPhotons(G4int n)
+  { if (n > 0) { fCutShort = true; fNDecidedEarly++; fNKilledPhotons += n; } }
+  /// Photons of the current event were killed: its photon count is incomplete
+  G4bool IsCutShort() const { return fCutShort; }
+  /// Final decision, from the hits of the event
+  G4bool EndOfEvent(const SiPMHitCollection* hits);
+  /// Print the merged counts (master, end of run)
+  void Print() const;
+
+  /// Checkpoint: save the counts, and add saved ones to the current ones
+  void Save(std::ostream& out) const;
+  void Restore(std::istream& in);
+
+  /// Photons are tracked panel by panel
+  G4bool IsStaged() const { return fEnabled && fNPanels > 1; }
+  G4int GetTrackedPanel() const { return fTrackedPanel; }
+  G4int GetNumberOfPanels() const { return fNPanels; }
+  G4int GetFiredPanels() const { return fNFired; }
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)             { fEnabled = value; }
+  void SetFold(G4int value)                 { fFold = value; }
+  void SetMinPhotons(G4int value)           { fMinPhotons = value; }
+
+private:
+  void CountFiredPanels(const SiPMHitCollection* hits);
+
+  static G4ThreadLocal FPCoincidenceTrigger* fgInstance;
+
+  // Settings
+  G4bool fEnabled;
+  G4int  fFold;                         // 0: all the panels
+  G4int  fMinPhotons;                   // per panel
+
+  // Current event
+  G4int fNPanels;
+  G4int fRequired;
+  G4int fTrackedPanel;
+  G4int fNFired;
+  G4bool fCutShort;
+  std::vector<G4int>  fPanelPhotons;    // held back, per panel
+  std::vector<G4int>  fPanelHits;
+  std::vector<G4bool> fPanelTracked;
+
+  // Run counts
+  G4long fNEvents;
+  G4long fNTriggered;
+  G4long fNDecidedEarly;                // events with photons killed by a fixed outcome
+  G4long fNKilledPhotons;
+
+  FPCoincidenceTriggerMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,36 @@
+/// October 19, 2026: Coincidence trigger messenger.
+///
+///    Commands under /FP/trigger/.
+
+#ifndef FPCoincidenceTriggerMessenger_h
+#define FPCoincidenceTriggerMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPCoincidenceTrigger;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPCoincidenceTriggerMessenger: public G4UImessenger
+{
+public:
+  FPCoincidenceTriggerMessenger(FPCoincidenceTrigger*);
+  ~FPCoincidenceTriggerMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPCoincidenceTrigger*        FPTrigger;
+  G4UIdirectory*                   triggerDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithAnInteger*        SetFoldCmd;
+  G4UIcmdWithAnInteger*        SetMinPhotonsCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
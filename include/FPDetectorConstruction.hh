@@ -6,6 +6,17 @@
 ///                        Redefine the data members of the detector components.
 ///                        including material types
 /// 
+/// October 19, 2026: Optional fast simulation model for photons trapped in the WLS fiber,
+///                   enabled with /FP/det/fiberFastModel (see FPDetectorMessenger).
+///
+/// October 19, 2026: Optical properties are read from a file (see FPOpticalPropertyDB).
+///
+/// October 19, 2026: Stack of panels (cosmic telescope). The wrapped panel and its SiPM form
+///                   one module volume placed once per panel; the copy number of the module
+///                   is the panel (and SiPM channel) number.
+///
+/// October 19, 2026: Panel thickness setting, and rebuild of the geometry between runs.
+///
 
 #ifndef FPDetectorConstruction_h
 #define FPDetectorConstruction_h 1
@@ -13,9 +24,14 @@
 #include "G4VUserDetectorConstruction.hh"
 #include "globals.hh"
 
+#include <map>
+
 class G4VPhysicalVolume;
 class G4LogicalVolume;
 class G4Material;
+class G4Region;
+class FPDetectorMessenger;
+class FPOpticalPropertyDB;
 
 /// Detector construction class to define materials and geometry.
 ///
@@ -33,6 +49,25 @@ public:
   virtual void ConstructSDandField();
   // function for reading in configuration file
   void split(const std::string &s, char delim, std::vector<std::string> &elems);   
+
+  void SetFiberFastModel(G4bool value) { fFiberFastModel = value; }
+  G4bool IsFiberFastModel() const { return fFiberFastModel; }
+  void SetOpticalPropertyFile(const G4String& fileName) { opticalPropertyFile = fileName; }
+  FPOpticalPropertyDB* GetOpticalProperties() const { return opticalProperties; }
+
+  // Panel stack: panel 0 at the origin, the others below it along -z
+  void SetNumberOfPanels(G4int n) { fNPanels = n; }
+  void SetPanelSpacing(G4double spacing) { fPanelSpacing = spacing; }
+  void SetFiberOffset(G4int panel, G4double offset) { fPanelFiberOffsets[panel] = offset; }
+  void SetPanelThickness(G4double thickness) { panelZ = thickness; }
+  G4int GetNumberOfPanels() const { return fNPanels; }
+  G4double GetPanelSpacing() const { return fPanelSpacing; }
+  /// Position of the fiber (and SiPM) along y in a panel
+  G4double GetFiberOffset(G4int panel) const;
+
+  /// After a change between runs: the geometry is built again by the next run,
+  /// keeping the materials, the physics tables and the sensitive detector
+  void RebuildGeometry();
   
 private:
   void DefineMaterials();
@@ -47,8 +82,23 @@ private:
   G4Material *default_mat, *wrapping_mat;
 
   G4LogicalVolume* sipmLV;
+  G4LogicalVolume* fiberLV;
+  G4LogicalVolume* claddingLV;
+  G4Region*        fiberRegion;        // envelope of the fiber fast model
   
+  G4int    fNPanels;
+  G4double fPanelSpacing;                // between panel centers
+  G4double fFiberOffset;                 // default fiber position, from runConfig.txt
+  std::map<G4int, G4double> fPanelFiberOffsets;
+
+  G4bool  fGeometryModified;            // rebuild requested, not done yet
   G4bool  fCheckOverlaps;
+  G4bool  fFiberFastModel;
+
+  G4String             opticalPropertyFile;
+  FPOpticalPropertyDB* opticalProperties;
+
+  FPDetectorMessenger* detectorMessenger;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,42 @@
+/// October 19, 2026: Detector construction messenger.
+///
+///    Commands under /FP/det/ controlling optional detector features.
+
+#ifndef FPDetectorMessenger_h
+#define FPDetectorMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPDetectorConstruction;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcommand;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPDetectorMessenger: public G4UImessenger
+{
+public:
+  FPDetectorMessenger(FPDetectorConstruction*);
+  ~FPDetectorMessenger();
+  
+  void SetNewValue(G4UIcommand*, G4String);
+  
+private:
+  FPDetectorConstruction*      FPDetector;
+  G4UIdirectory*                   detDir;
+  G4UIcmdWithABool*            SetFiberFastModelCmd;
+  G4UIcmdWithAString*          SetOpticalPropertyFileCmd;
+  G4UIcmdWithAnInteger*        SetNumberOfPanelsCmd;
+  G4UIcmdWithADoubleAndUnit*   SetPanelSpacingCmd;
+  G4UIcmdWithADoubleAndUnit*   SetPanelThicknessCmd;
+  G4UIcommand*                 SetFiberOffsetCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
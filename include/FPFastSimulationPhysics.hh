@@ -0,0 +1,30 @@
+/// October 19, 2026: Fast simulation of the optical photons, for the WLS
+///    fiber model only.
+///
+///    G4FastSimulationPhysics for the optical photons, constructed only if
+///    the fiber fast model is enabled (/FP/det/fiberFastModel, PreInit):
+///    otherwise every optical photon step would go through the fast
+///    simulation manager process for nothing. The choice is read from the
+///    detector construction when the physics is constructed, after the
+///    PreInit commands.
+
+#ifndef FPFastSimulationPhysics_h
+#define FPFastSimulationPhysics_h 1
+
+#include "G4FastSimulationPhysics.hh"
+#include "globals.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPFastSimulationPhysics : public G4FastSimulationPhysics
+{
+public:
+  FPFastSimulationPhysics();
+  virtual ~FPFastSimulationPhysics();
+
+  virtual void ConstructProcess();
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
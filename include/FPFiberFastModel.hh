@@ -0,0 +1,70 @@
+/// October 19, 2026: Fast simulation model for the WLS fiber.
+///
+///    A photon re-emitted by the WLS process inside the fiber core is either
+///    trapped by total internal reflection at the core/cladding interface or
+///    leaves the fiber after a few steps. For a straight fiber the angle of
+///    incidence on the wall is the same at every reflection, so trapping is
+///    decided analytically at the emission point from the core and cladding
+///    refractive indices (skew rays included). Trapped photons are moved in
+///    one step to the fiber end they are heading to, with the fiber
+///    attenuation and the time of flight (at the group velocity of the core,
+///    GROUPVEL) taken from tables built from the fiber material properties. Untrapped photons are left to the normal
+///    optical tracking.
+///
+///    The model is attached to the region rooted at CladdingLV, whose local
+///    frame is the fiber frame (fiber axis along local z).
+///
+///    The tables follow the property changes made between runs (FPOpticalControl).
+
+#ifndef FPFiberFastModel_h
+#define FPFiberFastModel_h 1
+
+#include "G4VFastSimulationModel.hh"
+#include "FPOpticalPropertyDB.hh"
+#include "globals.hh"
+
+class G4LogicalVolume;
+class G4Material;
+class G4VProcess;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPFiberFastModel : public G4VFastSimulationModel
+{
+public:
+  FPFiberFastModel(const G4String& name, G4Region* envelope,
+		   const G4LogicalVolume* fiberLV, const G4Material* claddingMaterial,
+		   G4double coreRadius, G4double halfLength);
+  virtual ~FPFiberFastModel();
+
+  virtual G4bool IsApplicable(const G4ParticleDefinition&);
+  virtual G4bool ModelTrigger(const G4FastTrack&);
+  virtual void DoIt(const G4FastTrack&, G4FastStep&);
+
+  /// Rebuild the index and attenuation tables from the material properties
+  void BuildTables();
+  /// Fiber core of a rebuilt geometry
+  void SetFiberVolume(const G4LogicalVolume* fiberLV) { fFiberLV = fiberLV; }
+
+private:
+  const G4LogicalVolume* fFiberLV;
+  const G4Material*      fCladdingMaterial;
+  G4double               fCoreRadius;
+  G4double               fHalfLength;
+
+  G4double               fCoreIndex;
+  G4double               fMaxWallCosine2;  // 1 - (n_clad/n_core)^2
+  G4PhysicsFreeVector*   fAttenuation;     // combined WLS and bulk attenuation length
+  FPPropertyLookup       fAttenuationLookup;
+  const G4MaterialPropertyVector* fGroupVelocity;  // of the core, nullptr: c/n
+  FPPropertyLookup       fGroupVelocityLookup;
+  const G4VProcess*      fWLSProcess;      // cached lookup of "OpWLS"
+  G4int                  fPropertyGeneration;   // of the properties the tables were built from
+
+  G4int                  fNTrapped;
+  G4int                  fNAbsorbed;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,82 @@
+/// October 19, 2026: Geometry and optical variants run in forked processes.
+///
+///    The threads of a run share one geometry, so variants of the detector
+///    (fiber offsets, panel thickness...) are normally separate jobs, each
+///    paying the full initialization. Here the physics tables are built once
+///    in the parent process, which then forks one child per variant, at most
+///    maxProcesses at a time; the children share the tables copy-on-write.
+///    Each child
+///      - executes the macro of its variant (geometry commands such as
+///        /FP/det/fiberOffset or /FP/det/panelThickness, optical settings),
+///      - writes its output (log, ROOT file, hit streams...) in a directory
+///        named after the variant,
+///      - runs its events and sends its light yield and eLoss statistics back
+///        through a pipe.
+///    The parent prints the results of all the variants and writes them to
+///    a summary file.
+///
+///    Forking needs a single-threaded process: start fiberPanel with -j to
+///    use the sequential run manager. The children start from the same random
+///    state (correlated variants); a variant macro may set /random/setSeeds.
+///    Optical settings that modify the physics (/FP/optical/...) rebuild the
+///    tables in the child. Commands under /FP/fork/.
+
+#ifndef FPForkDriver_h
+#define FPForkDriver_h 1
+
+#include "globals.hh"
+
+#include <vector>
+
+class FPForkDriverMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPForkDriver
+{
+public:
+  static FPForkDriver* Instance();
+  ~FPForkDriver();
+
+  void AddVariant(const G4String& name, const G4String& macro);
+  void ClearVariants() { fVariants.clear(); }
+  /// Run nEvents in every variant, then report
+  void BeamOn(G4int nEvents);
+
+  void SetMaxProcesses(G4int n)               { fMaxProcesses = n; }
+  void SetSummaryFile(const G4String& name)   { fSummaryFile = name; }
+
+private:
+  struct Variant {
+    G4String name;
+    G4String macro;
+  };
+
+  /// Sent by a child through its pipe
+  struct Result {
+    G4long   nEvents;
+    G4double lightYield;
+    G4double lightYieldError;
+    G4double eLoss;
+    G4double eLossError;
+    G4double seconds;
+  };
+
+  FPForkDriver();
+
+  /// Build the physics tables before forking, to share them
+  void BuildPhysicsTables() const;
+  /// Child process: run a variant and write its result, never returns
+  void RunVariant(const Variant& variant, G4int nEvents, int resultPipe) const;
+  void Report(const std::vector<Result>& results, const std::vector<G4bool>& done) const;
+
+  std::vector<Variant> fVariants;
+  G4int    fMaxProcesses;                 // 0: number of cores
+  G4String fSummaryFile;
+
+  FPForkDriverMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
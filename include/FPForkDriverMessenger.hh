@@ -0,0 +1,40 @@
+/// October 19, 2026: Fork driver messenger.
+///
+///    Commands under /FP/fork/.
+
+#ifndef FPForkDriverMessenger_h
+#define FPForkDriverMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPForkDriver;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithoutParameter;
+class G4UIcommand;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPForkDriverMessenger: public G4UImessenger
+{
+public:
+  FPForkDriverMessenger(FPForkDriver*);
+  ~FPForkDriverMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPForkDriver*                FPFork;
+  G4UIdirectory*                   forkDir;
+  G4UIcommand*                 AddVariantCmd;
+  G4UIcmdWithoutParameter*     ClearVariantsCmd;
+  G4UIcmdWithAnInteger*        SetMaxProcessesCmd;
+  G4UIcmdWithAString*          SetSummaryFileCmd;
+  G4UIcmdWithAnInteger*        BeamOnCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,121 @@
+/// October 19, 2026: Raw stream of the detected photons.
+///
+///    Every photon collected by FPSiPMSD (event ID, channel, time, position,
+///    wavelength) is written to a binary file of the thread, without going
+///    through the shared analysis manager:
+///      - the event action encodes the hits of each event into the chunk
+///        being filled,
+///      - a full chunk is handed to a writer thread (one per simulation
+///        thread), which writes it while the next chunk is filled. If the
+///        writer is still busy the chunk being filled just grows: the
+///        simulation never waits for the disk, except at the end of run.
+///
+///    Files, per run R and thread T:
+///      <fileName>.runR.tT.hits       header, then chunks
+///      <fileName>.runR.tT.hits.idx   event index: event ID, chunk offset,
+///                                    offset of the event in the chunk
+///    A chunk is a header (event and hit counts, raw and stored sizes,
+///    compression flag) followed by the events, optionally zlib compressed.
+///    Within an event the values are quantized (time 1 ps, position 1 um,
+///    wavelength 0.01 nm), delta encoded from hit to hit and written as
+///    variable-length integers. ReadEvent() gives random access through the
+///    index. Commands under /FP/hits/.
+
+#ifndef FPHitStream_h
+#define FPHitStream_h 1
+
+#include "SiPMhit.hh"
+#include "G4Threading.hh"
+#include "G4ThreeVector.hh"
+#include "globals.hh"
+
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class FPHitStreamMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// One detected photon, as read back from a stream
+
+struct FPStreamHit
+{
+  G4int         channel;
+  G4double      time;
+  G4ThreeVector position;
+  G4double      wavelength;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPHitStream
+{
+public:
+  FPHitStream();
+  ~FPHitStream();
+
+  /// Remember the run; the files are opened by the first event of the thread
+  void BeginOfRun(G4int runID);
+  /// Encode the hits of an event (calling thread)
+  void AddEvent(G4int eventID, const SiPMHitCollection* hits);
+  /// Write the last chunk, stop the writer and close the files
+  void EndOfRun();
+
+  /// Hits of one event of a stream file, through its index
+  static G4bool ReadEvent(const G4String& fileName, G4int eventID,
+			  std::vector<FPStreamHit>& hits);
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)             { fEnabled = value; }
+  void SetFileName(const G4String& name)    { fFileName = name; }
+  void SetCompression(G4bool value)         { fCompression = value; }
+  void SetChunkSize(G4int bytes)            { fChunkSize = bytes; }
+
+private:
+  struct Chunk {
+    std::string data;                   // encoded events
+    std::vector<G4int>    eventIDs;
+    std::vector<uint32_t> eventOffsets;  // in data
+    uint32_t nHits = 0;
+    void Clear() { data.clear(); eventIDs.clear(); eventOffsets.clear(); nHits = 0; }
+  };
+
+  void Open();
+  void Submit(G4bool last);
+  void WriterLoop();
+  void WriteChunk(const Chunk& chunk);
+
+  // Settings
+  G4bool   fEnabled;
+  G4String fFileName;
+  G4bool   fCompression;
+  G4int    fChunkSize;
+
+  G4int  fRunID;
+  G4bool fOpen;
+
+  // Filled by the simulation thread
+  Chunk fFilling;
+
+  // Handed over to the writer thread, guarded by fMutex
+  G4Mutex     fMutex;
+  G4Condition fCondition;
+  Chunk       fPending;
+  G4bool      fHasPending;
+  G4bool      fStopping;
+  std::thread fWriter;
+
+  // Owned by the writer thread while it runs
+  std::ofstream fOut;
+  std::ofstream fIndex;
+  uint64_t      fOffset;
+  std::string   fCompressed;
+
+  FPHitStreamMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,38 @@
+/// October 19, 2026: Hit stream messenger.
+///
+///    Commands under /FP/hits/.
+
+#ifndef FPHitStreamMessenger_h
+#define FPHitStreamMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPHitStream;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPHitStreamMessenger: public G4UImessenger
+{
+public:
+  FPHitStreamMessenger(FPHitStream*);
+  ~FPHitStreamMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPHitStream*                 FPStream;
+  G4UIdirectory*                   hitsDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithAString*          SetFileNameCmd;
+  G4UIcmdWithABool*            SetCompressCmd;
+  G4UIcmdWithAnInteger*        SetChunkSizeCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
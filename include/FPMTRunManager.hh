@@ -0,0 +1,89 @@
+/// October 19, 2026: Multi-threaded run manager with adaptive event batches.
+///
+///    The cost of an event spans orders of magnitude (a lone optical photon
+///    against a muon crossing the panel diagonally), so the fixed event
+///    modulo of G4MTRunManager leaves threads idle at the end of the run
+///    while another one finishes a large batch. Here each request of a worker
+///    gets a batch sized from
+///      - the events left: at most remaining/(2 nThreads), so the batches
+///        shrink towards the end of the run (guided scheduling),
+///      - the measured event cost: batches of about batchTime seconds, made
+///        smaller by the spread of the cost (mean x (1 + RMS/mean)).
+///    The cost is measured per batch of each thread; until every thread has
+///    completed a batch, batches are single events. The events are seeded one
+///    by one as in G4MTRunManager, so the results do not depend on the batches
+///    (unless /run/eventModulo asks for seeding once per batch).
+///
+///    At the end of each run the per-thread load is reported: events,
+///    batches, busy and idle time, and the time the threads that finished
+///    first waited for the last one. Commands under /FP/mt/ (master only).
+
+#ifndef FPMTRunManager_h
+#define FPMTRunManager_h 1
+
+#include "G4MTRunManager.hh"
+#include "FPWelford.hh"
+#include "G4Threading.hh"
+#include "globals.hh"
+
+#include <chrono>
+#include <vector>
+
+class FPMTRunManagerMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPMTRunManager : public G4MTRunManager
+{
+public:
+  FPMTRunManager();
+  virtual ~FPMTRunManager();
+
+  // G4MTRunManager
+  virtual void InitializeEventLoop(G4int n_event, const char* macroFile = nullptr,
+				   G4int n_select = -1);
+  virtual G4int SetUpNEvents(G4Event* evt, G4SeedsQueue* seedsQueue,
+			     G4bool reseedRequired = true);
+  virtual void RunTermination();
+
+  void SetAdaptive(G4bool value)         { fAdaptive = value; }
+  void SetBatchTime(G4double seconds)    { fBatchTime = seconds; }
+  void SetMaxBatch(G4int n)              { fMaxBatch = n; }
+  void SetReport(G4bool value)           { fReport = value; }
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  struct ThreadLoad {
+    G4int  nEvents = 0;
+    G4int  nBatches = 0;
+    G4int  batchEvents = 0;                 // in the batch being processed
+    G4bool started = false;
+    G4bool finished = false;
+    G4double busy = 0.;                     // seconds
+    Clock::time_point batchStart;
+    Clock::time_point finish;
+  };
+
+  /// Events of the next batch (fMutex held)
+  G4int NextBatchSize() const;
+  void PrintLoad() const;
+
+  // Settings
+  G4bool   fAdaptive;
+  G4double fBatchTime;                      // seconds
+  G4int    fMaxBatch;                       // 0: no limit
+  G4bool   fReport;
+
+  // Current run, guarded by fMutex
+  G4Mutex  fMutex;
+  std::vector<ThreadLoad> fThreads;
+  FPWelford fEventCost;                     // seconds per event, one entry per batch
+  Clock::time_point fRunStart;
+
+  FPMTRunManagerMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
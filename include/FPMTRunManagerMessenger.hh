@@ -0,0 +1,38 @@
+/// October 19, 2026: Multi-threaded run manager messenger.
+///
+///    Commands under /FP/mt/.
+
+#ifndef FPMTRunManagerMessenger_h
+#define FPMTRunManagerMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPMTRunManager;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADoubleAndUnit;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPMTRunManagerMessenger: public G4UImessenger
+{
+public:
+  FPMTRunManagerMessenger(FPMTRunManager*);
+  ~FPMTRunManagerMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPMTRunManager*              FPRunManager;
+  G4UIdirectory*                   mtDir;
+  G4UIcmdWithABool*            SetAdaptiveCmd;
+  G4UIcmdWithADoubleAndUnit*   SetBatchTimeCmd;
+  G4UIcmdWithAnInteger*        SetMaxBatchCmd;
+  G4UIcmdWithABool*            SetReportCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,89 @@
+/// October 19, 2026: Memory footprint report, per thread and per subsystem.
+///
+///    At the end of each run every thread records
+///      - the size of its G4Allocator pools: tracks, dynamic particles,
+///        touchables, track information, trajectories and their points,
+///        SiPM hits (the pools never shrink: this is their peak size),
+///      - the peak number of urgent and waiting tracks in its stacks,
+///      - the largest hits collection of an event, in hits and bytes,
+///      - an estimate of the memory of its histograms,
+///    and the master prints them with the peak and current resident set size
+///    of the process, and writes them as JSON (memory.json) so that the
+///    memory requests of the batch jobs can be set from data. Optionally the
+///    resident set size is printed every given number of events.
+///
+///    One instance is shared by all threads; the records of the threads are
+///    added under a mutex. Commands under /FP/memory/ (master only).
+
+#ifndef FPMemoryReport_h
+#define FPMemoryReport_h 1
+
+#include "G4Threading.hh"
+#include "globals.hh"
+
+#include <atomic>
+#include <vector>
+
+class FPMemoryReportMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPMemoryReport
+{
+public:
+  static FPMemoryReport* Instance();
+  ~FPMemoryReport();
+
+  /// Master, beginning of run: forget the records of the previous run
+  void BeginOfRun();
+  /// Any thread, beginning of its run
+  void BeginOfThreadRun();
+  /// Any thread, end of each event, with the size of its hits collection
+  void EndOfEvent(std::size_t nHits);
+  /// Any thread, end of its run: record its pools, stacks and histograms
+  void EndOfThreadRun(G4int nEvents);
+  /// Master, end of run: print and write the report
+  void EndOfRun(G4int runID);
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)            { fEnabled = value; }
+  void SetFileName(const G4String& name)   { fFileName = name; }
+  void SetInterval(G4int nEvents)          { fInterval = nEvents; }
+
+  /// Resident set size of the process, now and at its peak, in kB
+  static long GetCurrentRSS();
+  static long GetPeakRSS();
+
+private:
+  FPMemoryReport();
+
+  struct ThreadRecord {
+    G4int thread = 0;
+    G4int nEvents = 0;
+    std::vector<std::pair<G4String, std::size_t> > pools;   // name, bytes
+    G4int peakUrgentTracks = 0;
+    G4int peakWaitingTracks = 0;
+    std::size_t peakHits = 0;
+    std::size_t histogramBytes = 0;
+  };
+
+  void Print(const std::vector<ThreadRecord>& records) const;
+  void Write(G4int runID, const std::vector<ThreadRecord>& records) const;
+
+  // Configuration (set from the master UI, read by the workers)
+  G4bool   fEnabled;
+  G4String fFileName;
+  G4int    fInterval;         // events between two RSS lines, 0: none
+
+  G4Mutex fMutex;
+  std::vector<ThreadRecord> fRecords;   // guarded by fMutex
+  std::atomic<G4int> fEvents;           // events of the run, all threads
+
+  static G4ThreadLocal std::size_t fgPeakHits;
+
+  FPMemoryReportMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
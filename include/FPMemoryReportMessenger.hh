@@ -0,0 +1,37 @@
+/// October 19, 2026: Memory report messenger.
+///
+///    Commands under /FP/memory/.
+
+#ifndef FPMemoryReportMessenger_h
+#define FPMemoryReportMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPMemoryReport;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPMemoryReportMessenger: public G4UImessenger
+{
+public:
+  FPMemoryReportMessenger(FPMemoryReport*);
+  ~FPMemoryReportMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPMemoryReport*              FPMemory;
+  G4UIdirectory*                   memoryDir;
+  G4UIcmdWithABool*            SetReportCmd;
+  G4UIcmdWithAString*          SetFileNameCmd;
+  G4UIcmdWithAnInteger*        SetIntervalCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,99 @@
+/// October 19, 2026: Optical boundary process with a fast path for the
+///                   constant-index interfaces.
+///
+///    Every dielectric interface of the panel joins two materials of
+///    constant refractive index (panel 1.58, epoxy 1.57, cladding 1.49,
+///    fiber 1.60, air 1.0) without an optical surface, so that the stock
+///    process does for each hit the surface and property lookups, the
+///    index interpolations and the Fresnel coefficients of a polished
+///    dielectric-dielectric boundary which never change. With the fast path
+///    on (/FP/optical/fastBoundary), such a boundary is looked up once per
+///    pair of volumes; its transmission probabilities for the two
+///    polarizations are tabulated against the cosine of the incidence
+///    angle, and the photon is reflected (Fresnel or total internal
+///    reflection) or refracted with the same kinematics and polarization as
+///    G4OpBoundaryProcess. Any other boundary (optical surface, varying
+///    index, missing RINDEX, same material) goes to G4OpBoundaryProcess.
+///
+///    The process keeps the name and class of the stock one, so that
+///    /process/(in)activate OpBoundary and the consumers reading its status
+///    work unchanged. The interfaces are looked up again at each run (the
+///    geometry may have been rebuilt), when the fast path setting is read.
+
+#ifndef FPOpBoundaryProcess_h
+#define FPOpBoundaryProcess_h 1
+
+#include "G4OpBoundaryProcess.hh"
+#include "globals.hh"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+class G4Material;
+class G4Navigator;
+class G4VPhysicalVolume;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPOpBoundaryProcess : public G4OpBoundaryProcess
+{
+public:
+  explicit FPOpBoundaryProcess(const G4String& processName = "OpBoundary");
+  virtual ~FPOpBoundaryProcess();
+
+  virtual G4VParticleChange* PostStepDoIt(const G4Track& track, const G4Step& step);
+  virtual G4OpBoundaryProcessStatus GetStatus() const;
+
+  /// Transmission probabilities of a pair of constant indices, against the
+  /// cosine of the incidence angle (0 to 1, kBins intervals)
+  class FresnelTable {
+  public:
+    static const G4int kBins = 4096;
+
+    FresnelTable(G4double n1, G4double n2);
+
+    /// Exact Fresnel transmission for s (perpendicular) and p (parallel) polarization
+    static void Transmission(G4double n1, G4double n2, G4double cost1,
+			     G4double& transS, G4double& transP);
+    /// Tabulated, for a polarization with fraction perp2 of perpendicular intensity
+    G4double GetTransmission(G4double cost1, G4double perp2) const;
+
+    G4double GetN1() const { return fN1; }
+    G4double GetN2() const { return fN2; }
+
+  private:
+    G4double fN1, fN2;
+    std::vector<G4double> fTransS, fTransP;
+  };
+
+private:
+  struct Interface {
+    Interface(G4double n1, G4double n2);
+    FresnelTable table;
+    G4double velocity;             // group velocity beyond the boundary
+  };
+
+  /// nullptr if the boundary must go to G4OpBoundaryProcess
+  const Interface* FindInterface(const G4VPhysicalVolume* pre, const G4VPhysicalVolume* post);
+  /// Constant RINDEX of the material, 0 if it has none or it varies
+  static G4double ConstantIndex(const G4Material* material);
+
+  G4VParticleChange* FastPostStepDoIt(const G4Track& track, const G4Step& step,
+				      const Interface& interface, const G4ThreeVector& normal);
+
+  G4bool fFastPath;
+  G4int  fRunID;
+  G4Navigator* fNavigator;
+
+  G4bool fUsedFast;                              // for the status of the last step
+  G4OpBoundaryProcessStatus fFastStatus;
+
+  // Per pair of volumes (cleared at each run), per pair of indices (kept)
+  std::map<std::pair<const G4VPhysicalVolume*, const G4VPhysicalVolume*>, const Interface*> fInterfaces;
+  std::map<std::pair<G4double, G4double>, Interface*> fIndexPairs;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
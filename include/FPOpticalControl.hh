@@ -0,0 +1,122 @@
+/// October 19, 2026: Runtime control of the optical physics.
+///
+///    The settings that trade fidelity for throughput in the optical
+///    processes, applied to G4OpticalParameters (shared by all threads):
+///      - track the optical photons of a step before the parent continues
+///        (scintillation and Cerenkov): keeps the stacks small,
+///      - maximum number of Cerenkov photons and maximum change of beta per
+///        step of the parent,
+///      - a factor on the scintillation yield (SCINTILLATIONYIELD) of every
+///        material, since GEANT4 11 has no yield factor parameter any more,
+///      - activation of each optical process.
+///    Before the initialization the settings are picked up by G4OpticalPhysics;
+///    between runs the processes are re-initialized (/run/physicsModified) and
+///    the processes (in)activated with /process/(in)activate. The defaults
+///    are those of GEANT4: photons tracked first, 100 photons and 10 % beta
+///    change per step, as in the configuration used before July 2024.
+///
+///    One instance for the whole job, created in main(). Commands under
+///    /FP/optical/ (master only).
+///
+/// October 19, 2026: Energy-loss-only mode, for the muon eLoss calibration.
+///    Between runs, every active optical process is inactivated and the SiPM
+///    sensitive detector switched off (/hits/inactivate, broadcast to the
+///    workers); the event and run actions then keep only the eLoss and the
+///    step count. Leaving the mode restores the processes it switched off.
+///
+/// October 19, 2026: Fast path of the boundary process for the constant-index
+///    interfaces (FPOpBoundaryProcess), read by the workers at each run.
+///    Same for the batched photon generation of the scintillation (FPScintillation).
+///
+/// October 19, 2026: Optical property scans in one session. Between runs a
+///    property of the property file (FPOpticalPropertyDB) is set or scaled in
+///    the shared material and surface tables. The absorption lengths,
+///    reflectivities and yields are read by the processes at each step; the
+///    spectra tabulated by the processes (scintillation and WLS emission,
+///    Rayleigh) and the fiber attenuation of the fast model are rebuilt by
+///    each thread at the next run, without /run/physicsModified. RINDEX is
+///    not changed: the Cerenkov tables are built once for the job.
+///    REFLECTIVITY and EFFICIENCY are refused for a material: GEANT4 reads
+///    them from the optical surfaces only (the EJ200 REFLECTIVITY of the
+///    property file has no effect on the panel).
+
+#ifndef FPOpticalControl_h
+#define FPOpticalControl_h 1
+
+#include "globals.hh"
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+class FPOpticalControlMessenger;
+class FPOpticalPropertyDB;
+class G4MaterialPropertiesTable;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPOpticalControl
+{
+public:
+  static FPOpticalControl* Instance();
+  ~FPOpticalControl();
+
+  void SetTrackSecondariesFirst(G4bool value);
+  void SetMaxPhotonsPerStep(G4int value);
+  void SetMaxBetaChange(G4double percent);
+  void SetYieldFactor(G4double value);
+  /// Optical process name, as in G4OpticalParameters (Scintillation, OpWLS...)
+  void SetProcessActivation(const G4String& process, G4bool active);
+
+  /// Idle only: the optical processes must have been constructed
+  void SetELossOnly(G4bool value);
+  void SetFastBoundary(G4bool value) { fFastBoundary = value; }
+  void SetBatchedScintillation(G4bool value) { fBatchedScintillation = value; }
+
+  /// Idle only: change a property of the property file between runs
+  void SetProperty(const G4String& target, const G4String& key, G4double value,
+		   const G4String& unit);
+  void ScaleProperty(const G4String& target, const G4String& key, G4double factor);
+  void ResetProperties();
+  /// The database of the detector construction
+  void SetPropertyDB(FPOpticalPropertyDB* db) { fPropertyDB = db; }
+  /// Each thread at the start of a run: rebuild the process tables of the changed properties
+  void UpdatePhysicsTables();
+
+  /// Scale the scintillation yields of the materials (detector construction)
+  void ApplyYieldFactor();
+  void Print() const;
+
+  G4double GetYieldFactor() const { return fYieldFactor; }
+  G4bool IsELossOnly() const { return fELossOnly; }
+  G4bool IsFastBoundary() const { return fFastBoundary; }
+  G4bool IsBatchedScintillation() const { return fBatchedScintillation; }
+  /// Incremented at each property change
+  G4int GetPropertyGeneration() const { return fPropertyGeneration.load(std::memory_order_relaxed); }
+
+private:
+  FPOpticalControl();
+
+  /// Re-initialize the optical processes if the physics is already built
+  void PhysicsModified() const;
+  G4bool CanModifyProperty(const G4String& target, const G4String& key) const;
+  void PropertyModified(G4MaterialPropertiesTable* table, const G4String& key);
+
+  G4double fYieldFactor;
+  std::map<G4MaterialPropertiesTable*, G4double> fBaseYields;   // unscaled
+
+  G4bool fELossOnly;
+  std::vector<G4String> fELossOnlyInactivated;   // to restore on leaving the mode
+
+  G4bool fFastBoundary;
+  G4bool fBatchedScintillation;
+
+  FPOpticalPropertyDB* fPropertyDB;
+  std::atomic<G4int> fPropertyGeneration;
+
+  FPOpticalControlMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,48 @@
+/// October 19, 2026: Optical physics control messenger.
+///
+///    Commands under /FP/optical/.
+
+#ifndef FPOpticalControlMessenger_h
+#define FPOpticalControlMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPOpticalControl;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADouble;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithoutParameter;
+class G4UIcommand;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPOpticalControlMessenger: public G4UImessenger
+{
+public:
+  FPOpticalControlMessenger(FPOpticalControl*);
+  ~FPOpticalControlMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPOpticalControl*            FPOptical;
+  G4UIdirectory*                   opticalDir;
+  G4UIcmdWithABool*            SetTrackSecondariesFirstCmd;
+  G4UIcmdWithAnInteger*        SetMaxPhotonsPerStepCmd;
+  G4UIcmdWithADouble*          SetMaxBetaChangeCmd;
+  G4UIcmdWithADouble*          SetYieldFactorCmd;
+  G4UIcommand*                 SetActivationCmd;
+  G4UIcmdWithABool*            SetELossOnlyCmd;
+  G4UIcmdWithABool*            SetFastBoundaryCmd;
+  G4UIcmdWithABool*            SetBatchedScintillationCmd;
+  G4UIcommand*                 SetPropertyCmd;
+  G4UIcommand*                 ScalePropertyCmd;
+  G4UIcmdWithoutParameter*     ResetPropertiesCmd;
+  G4UIcmdWithoutParameter*     PrintCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,34 @@
+/// October 19, 2026: Optical physics of the panel.
+///
+///    G4OpticalPhysics, with the boundary process of the optical photons
+///    replaced by FPOpBoundaryProcess (same name and activation), whose fast
+///    path for the constant-index interfaces is switched by
+///    /FP/optical/fastBoundary.
+///
+/// October 19, 2026: Same for the scintillation (FPScintillation), whose
+///    batched photon generation is switched by /FP/optical/batchedScintillation.
+
+#ifndef FPOpticalPhysics_h
+#define FPOpticalPhysics_h 1
+
+#include "G4OpticalPhysics.hh"
+#include "globals.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPOpticalPhysics : public G4OpticalPhysics
+{
+public:
+  FPOpticalPhysics();
+  virtual ~FPOpticalPhysics();
+
+  virtual void ConstructProcess();
+
+private:
+  void ReplaceBoundary();
+  void ReplaceScintillation();
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
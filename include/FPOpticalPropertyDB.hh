@@ -0,0 +1,111 @@
+/// October 19, 2026: Optical property database.
+///
+///    Reads the optical properties of the materials and surfaces from a text
+///    file (opticalProperties.txt by default) instead of hard-coded vectors:
+///
+///      grid     <name> <unit> <energies...>
+///      property <target> <key> <grid> <unit> <values...>
+///      const    <target> <key> <unit> <value>
+///
+///    <target> is a material name or "surface:<name>" for an optical surface,
+///    <unit> is a GEANT4 unit symbol, "1/<symbol>" or "-" when dimensionless,
+///    and values may be written "n*value" for n repeated entries. A line ending
+///    with '\' continues on the next one; '#' starts a comment.
+///
+///    A spectrum whose values are all equal is stored as a two-point table
+///    spanning its grid, and identical tables are shared between materials,
+///    so constant properties cost a trivial lookup in the optical processes.
+///
+/// October 19, 2026: Properties changed between runs (FPOpticalControl).
+///    A property is set to a value (a spectrum then becomes constant) or its
+///    value from the file scaled by a factor. Since vectors are shared, the
+///    change goes to a new vector, given to the table of that target only.
+
+#ifndef FPOpticalPropertyDB_h
+#define FPOpticalPropertyDB_h 1
+
+#include "G4MaterialPropertyVector.hh"
+#include "globals.hh"
+
+#include <map>
+#include <vector>
+
+class G4MaterialPropertiesTable;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// Lookup of a property vector remembering the last bin. Keep one instance
+/// per thread (e.g. as a member of a per-thread model) for spectra that are
+/// evaluated photon after photon at nearby energies.
+
+class FPPropertyLookup
+{
+public:
+  FPPropertyLookup(const G4MaterialPropertyVector* vector = nullptr)
+    : fVector(vector), fLastBin(0) {}
+
+  void SetVector(const G4MaterialPropertyVector* vector) { fVector = vector; fLastBin = 0; }
+  G4double Value(G4double energy) { return fVector->Value(energy, fLastBin); }
+
+private:
+  const G4MaterialPropertyVector* fVector;
+  std::size_t fLastBin;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPOpticalPropertyDB
+{
+public:
+  FPOpticalPropertyDB();
+  ~FPOpticalPropertyDB();
+
+  /// Read a property file; entries override those of earlier files
+  void Load(const G4String& fileName);
+
+  /// Attach the properties to the materials (creating the tables if needed)
+  void ApplyToMaterials();
+
+  /// Properties table of an optical surface, nullptr if the file has none
+  G4MaterialPropertiesTable* GetSurfaceTable(const G4String& surfaceName);
+
+  /// Change one property of a target in its material or surface table; the
+  /// factor applies to the value read from the file. Return the table changed,
+  /// nullptr (with a warning) if the target has no such property.
+  G4MaterialPropertiesTable* SetProperty(const G4String& target, const G4String& key,
+					 G4double value, const G4String& unit);
+  G4MaterialPropertiesTable* ScaleProperty(const G4String& target, const G4String& key,
+					   G4double factor);
+  /// Back to the properties read from the files
+  void ResetProperties();
+
+  G4int GetNumberOfSharedVectors() const { return (G4int) fVectors.size(); }
+
+private:
+  struct Property {
+    G4String key;
+    G4bool   isConst;
+    G4double value;                       // for const properties
+    G4MaterialPropertyVector* vector;     // for spectra (shared)
+  };
+
+  G4double ParseUnit(const G4String& unit, const G4String& where) const;
+  void ParseValues(std::vector<G4String>& tokens, std::size_t first, G4double unit,
+		   std::vector<G4double>& values, const G4String& where) const;
+  G4MaterialPropertyVector* MakeVector(const std::vector<G4double>& energies,
+				       const std::vector<G4double>& values);
+  void AddEntry(const G4String& target, const Property& property);
+  void Fill(G4MaterialPropertiesTable* table, const std::vector<Property>& properties) const;
+  G4MaterialPropertiesTable* Modify(const G4String& target, const G4String& key,
+				    G4double value, G4bool scale);
+
+  std::map<G4String, std::vector<G4double> > fGrids;
+  std::map<G4String, std::vector<Property> > fTargets;        // material or surface:<name>
+  std::map<G4String, std::vector<Property> > fFileTargets;    // as read, before any change
+  std::map<std::vector<G4double>, G4MaterialPropertyVector*> fVectors;   // energies then values
+  std::map<G4String, G4MaterialPropertiesTable*> fSurfaceTables;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
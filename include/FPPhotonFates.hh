@@ -0,0 +1,99 @@
+/// October 19, 2026: Fate accounting of the optical photons.
+///
+///    Every optical photon that carries an FPTrackInformation is classified
+///    at the end of its track:
+///      - detected by the SiPM (marked by FPSiPMSD),
+///      - absorbed in the bulk of the panel, epoxy, cladding or fiber,
+///      - absorbed by WLS in the fiber (re-emitted as a new photon),
+///      - lost at the wrapping surface,
+///      - re-emitted by WLS but not trapped (ended outside the fiber),
+///      - escaped from the world,
+///      - killed by the application (time gate, weight cut, ...),
+///      - other.
+///    Counts and number of steps per fate are kept per event and summed per
+///    run; the worker sums are merged as an accumulable and printed by the
+///    master. Commands under /FP/fates/.
+
+#ifndef FPPhotonFates_h
+#define FPPhotonFates_h 1
+
+#include "G4VAccumulable.hh"
+#include "FPVolumeComponents.hh"
+#include "globals.hh"
+
+#include <iosfwd>
+
+class G4Track;
+class G4VProcess;
+class G4OpBoundaryProcess;
+class FPPhotonFatesMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPPhotonFates : public G4VAccumulable
+{
+public:
+  enum Fate { kDetected = 0, kAbsorbedPanel, kAbsorbedEpoxy, kAbsorbedCladding,
+	      kAbsorbedFiber, kWLSConverted, kLostWrapping, kWLSNotTrapped,
+	      kEscaped, kKilled, kOther, kNFates };
+
+  FPPhotonFates();
+  virtual ~FPPhotonFates();
+
+  /// The fates of the calling thread (nullptr before the run action exists)
+  static FPPhotonFates* Instance() { return fgInstance; }
+
+  // G4VAccumulable
+  virtual void Merge(const G4VAccumulable& other);
+  virtual void Reset();
+
+  void BeginOfRun();
+  void BeginOfEvent();
+  void EndOfEvent(G4int eventID);
+  /// Print the merged table (master, end of run)
+  void Print() const;
+
+  /// Checkpoint: save the run sums, and add saved sums to the current ones
+  void Save(std::ostream& out) const;
+  void Restore(std::istream& in);
+
+  /// Classify a finished optical photon (post tracking action)
+  void Classify(const G4Track* track);
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value) { fEnabled = value; }
+  void SetPrintEvents(G4bool value) { fPrintEvents = value; }
+
+  G4long GetEventCount(G4int fate) const { return fEventCounts[fate]; }
+  G4long GetRunCount(G4int fate) const   { return fRunCounts[fate]; }
+
+  static const char* GetFateName(G4int fate);
+
+private:
+  G4int ClassifyLastStep(const G4Track* track) const;
+  void ResolveProcesses();
+
+  static G4ThreadLocal FPPhotonFates* fgInstance;
+
+  G4bool fEnabled;
+  G4bool fPrintEvents;
+
+  G4long fEventCounts[kNFates];
+  G4long fEventSteps[kNFates];
+  G4long fRunCounts[kNFates];
+  G4long fRunSteps[kNFates];
+
+  FPVolumeComponents fComponents;
+
+  // Optical processes of this thread, looked up at the first photon
+  G4bool               fProcessesResolved;
+  const G4VProcess*    fAbsorption;
+  const G4VProcess*    fWLS;
+  G4OpBoundaryProcess* fBoundary;
+
+  FPPhotonFatesMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
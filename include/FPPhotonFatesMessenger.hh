@@ -0,0 +1,34 @@
+/// October 19, 2026: Photon fates messenger.
+///
+///    Commands under /FP/fates/.
+
+#ifndef FPPhotonFatesMessenger_h
+#define FPPhotonFatesMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPPhotonFates;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPPhotonFatesMessenger: public G4UImessenger
+{
+public:
+  FPPhotonFatesMessenger(FPPhotonFates*);
+  ~FPPhotonFatesMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPPhotonFates*               FPFates;
+  G4UIdirectory*                   fatesDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithABool*            SetPrintEventsCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,98 @@
+/// October 19, 2026: Bounce and path length limiter of the optical photons.
+///
+///    With the highly reflective wrapping and long absorption lengths, some
+///    photons bounce thousands of times in the panel before being absorbed.
+///    A step consumer of optical photons counts the reflections (from the
+///    status of the boundary process) and the path length of each photon in
+///    its FPTrackInformation. A photon reaching a limit (maxBounces or
+///    maxPathLength, 0 for none) is
+///      - killed (mode "kill"), or
+///      - killed with probability 1 - p (mode "roulette"); a survivor has
+///        its weight divided by p, and is played again at the next multiple
+///        of the limits. The weight goes to the SiPM hits, and the light
+///        yield of the event is the sum of the hit weights. The coincidence
+///        trigger and the SiPM digitizer count the hits, not their weights:
+///        a run with either of them enabled falls back to "kill".
+///    The killed photons get the "killed" fate. The numbers of photons cut,
+///    of their bounces and path length, and of roulette survivors, are
+///    merged as an accumulable and printed by the master.
+///
+///    One instance per thread, owned by the run action. Commands under /FP/limit/.
+
+#ifndef FPPhotonLimiter_h
+#define FPPhotonLimiter_h 1
+
+#include "G4VAccumulable.hh"
+#include "globals.hh"
+
+#include <iosfwd>
+
+class G4Track;
+class FPStepConsumer;
+class FPTrackInformation;
+class FPPhotonLimiterMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPPhotonLimiter : public G4VAccumulable
+{
+public:
+  enum Mode { kKill = 0, kRoulette };
+
+  FPPhotonLimiter();
+  virtual ~FPPhotonLimiter();
+
+  /// The limiter of the calling thread (nullptr before the run action exists)
+  static FPPhotonLimiter* Instance() { return fgInstance; }
+
+  // G4VAccumulable
+  virtual void Merge(const G4VAccumulable& other);
+  virtual void Reset();
+
+  /// Beginning of run: the mode of the run, kill if the readout ignores the hit weights
+  void BeginOfRun(G4bool unweightedReadout);
+
+  /// Step consumer counting and applying the limits; owned by the stepping action
+  FPStepConsumer* CreateStepConsumer();
+
+  /// Apply the limits to a photon after its counters were updated
+  void Check(G4Track* track, FPTrackInformation* info);
+  /// Print the merged counts (master, end of run)
+  void Print() const;
+
+  /// Checkpoint: save the counts, and add saved ones to the current ones.
+  /// The limits of the macro are kept (with a warning if the saved ones
+  /// differ) unless takeSettings is set, for a report of merged jobs (fpMerge)
+  void Save(std::ostream& out) const;
+  void Restore(std::istream& in, G4bool takeSettings = false);
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)             { fEnabled = value; }
+  void SetMaxBounces(G4int value)           { fMaxBounces = value; }
+  void SetMaxPathLength(G4double value)     { fMaxPathLength = value; }
+  void SetMode(G4int value)                 { fMode = value; }
+  void SetSurvival(G4double value)          { fSurvival = value; }
+
+private:
+  static G4ThreadLocal FPPhotonLimiter* fgInstance;
+
+  // Settings
+  G4bool   fEnabled;
+  G4int    fMaxBounces;         // 0: no limit
+  G4double fMaxPathLength;      // 0: no limit
+  G4int    fMode;
+  G4double fSurvival;           // roulette survival probability
+  G4int    fRunMode;            // fMode, or kKill if the readout ignores the weights
+
+  // Run counts
+  G4long   fNKilled;
+  G4long   fKilledBounces;
+  G4double fKilledPathLength;
+  G4long   fNSurvived;
+
+  FPPhotonLimiterMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
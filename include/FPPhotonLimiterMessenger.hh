@@ -0,0 +1,41 @@
+/// October 19, 2026: Photon limiter messenger.
+///
+///    Commands under /FP/limit/.
+
+#ifndef FPPhotonLimiterMessenger_h
+#define FPPhotonLimiterMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPPhotonLimiter;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADouble;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+class G4UIcmdWithADoubleAndUnit;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPPhotonLimiterMessenger: public G4UImessenger
+{
+public:
+  FPPhotonLimiterMessenger(FPPhotonLimiter*);
+  ~FPPhotonLimiterMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPPhotonLimiter*             FPLimiter;
+  G4UIdirectory*                   limitDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithAnInteger*        SetMaxBouncesCmd;
+  G4UIcmdWithADoubleAndUnit*   SetMaxPathLengthCmd;
+  G4UIcmdWithAString*          SetModeCmd;
+  G4UIcmdWithADouble*          SetSurvivalCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
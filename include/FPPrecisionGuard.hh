@@ -0,0 +1,37 @@
+/// October 19, 2026: Output precision of the reports.
+///
+///    The reports print their statistics with a few significant digits. A
+///    guard created at the top of a report function sets the precision of
+///    G4cout, if given, and gives the previous one back when it goes out of
+///    scope, whatever the return path: the std::setprecision of a report
+///    does not leak into the output that follows.
+
+#ifndef FPPrecisionGuard_h
+#define FPPrecisionGuard_h 1
+
+#include "globals.hh"
+
+#include <ios>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPPrecisionGuard
+{
+public:
+  explicit FPPrecisionGuard(std::streamsize precision = 0)
+    : fPrecision(G4cout.precision())
+  {
+    if (precision > 0) G4cout.precision(precision);
+  }
+  ~FPPrecisionGuard() { G4cout.precision(fPrecision); }
+
+  FPPrecisionGuard(const FPPrecisionGuard&) = delete;
+  FPPrecisionGuard& operator=(const FPPrecisionGuard&) = delete;
+
+private:
+  std::streamsize fPrecision;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
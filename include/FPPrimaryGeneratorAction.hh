@@ -8,6 +8,9 @@
 ///                 June 19, 2020: Hexc, Zachary and Nadia
 ///                 Implementing event generator messenger: i.e. particle gun position (x, y, z)
 ///
+///                 October 19, 2026: Added particle type 2, replaying primaries from a
+///                 memory-mapped binary file (see FPPrimaryReplayFile).
+///
 
 #ifndef FPPrimaryGeneratorAction_h
 #define FPPrimaryGeneratorAction_h 1
@@ -20,6 +23,7 @@ class G4ParticleGun;
 class G4Event;
 class G4UIcmdWith3VectorAndUnit;
 class FPPrimaryGeneratorMessenger;
+class FPPrimaryReplayFile;
 
 class FPPrimaryGeneratorAction : public G4VUserPrimaryGeneratorAction
 {
@@ -32,12 +36,19 @@ public:
   const G4ParticleGun* GetParticleGun() const { return fParticleGun; }
   inline void SetGunPosition(G4ThreeVector aVec){gunPosition = aVec;}
   inline void SetGunParticleType(G4int  nType){particleType = nType;}
+  void SetReplayFile(const G4String& fileName);
 
 private:
+  void GenerateReplayedPrimaries(G4Event*);
+
   G4ParticleGun*  fParticleGun;
   FPPrimaryGeneratorMessenger* generatorMessenger;
   G4ThreeVector  gunPosition;
-  G4int particleType;   // 0: optical photon, 1: muons 
+  G4int particleType;   // 0: optical photon, 1: muons, 2: replay from file
+
+  const FPPrimaryReplayFile* fReplayFile;     // shared, read-only mapping
+  G4int fLastPDG;                             // cache of the last particle lookup
+  G4ParticleDefinition* fLastDefinition;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -4,6 +4,8 @@
 /// August 3, 2020: Hexc, Zachary and Nadia
 ///                 Implementing particle type choices:  0 for optical photons; 1 for muons.
 ///
+/// October 19, 2026: Added the primary replay file command (particle type 2).
+///
 
 #ifndef FPPrimaryGeneratorMessenger_h
 #define FPPrimaryGeneratorMessenger_h 1
@@ -16,6 +18,7 @@ class G4UIdirectory;
 class G4UIcmdWithADoubleAndUnit;
 class G4UIcmdWithAnInteger;
 class G4UIcmdWith3VectorAndUnit;
+class G4UIcmdWithAString;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -32,6 +35,7 @@ private:
   G4UIdirectory*                           gunDir; 
   G4UIcmdWithAnInteger*           SetGunParticleType;
   G4UIcmdWith3VectorAndUnit*  SetGunPositionCmd;
+  G4UIcmdWithAString*            SetReplayFileCmd;
   
 };
 
@@ -0,0 +1,103 @@
+/// October 19, 2026: Memory-mapped primary-event replay file.
+///
+///    Primaries generated by external tools (cosmic, beta sources, ...) are
+///    stored in a compact binary file and read back through mmap, so that
+///    every worker thread can index the file directly by event ID without
+///    parsing or locking. The file layout (native byte order) is
+///
+///        FPReplayHeader                      (32 bytes)
+///        G4uint64 eventIndex[nEvents+1]     first primary of each event,
+///                                           eventIndex[nEvents] == nPrimaries
+///        FPReplayPrimary primaries[nPrimaries]
+///
+///    Energies are in MeV, positions in mm and times in ns (GEANT4 internal
+///    units); the direction does not need to be normalized.
+///
+///    Files are produced by Write(), e.g. through tools/fpReplayConvert from
+///    a text list of primaries.
+
+#ifndef FPPrimaryReplayFile_h
+#define FPPrimaryReplayFile_h 1
+
+#include "globals.hh"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct FPReplayHeader
+{
+  char          magic[8];       // "FPREPLY"
+  std::uint32_t version;        // currently 1
+  std::uint32_t recordSize;     // sizeof(FPReplayPrimary)
+  std::uint64_t nEvents;
+  std::uint64_t nPrimaries;
+};
+
+struct FPReplayPrimary
+{
+  std::int32_t pdg;             // PDG code (-22 or 0 for optical photons)
+  std::int32_t reserved;
+  double       energy;          // kinetic energy
+  double       x, y, z;         // vertex position
+  double       dx, dy, dz;      // momentum direction
+  double       t;               // vertex time
+};
+
+static_assert(sizeof(FPReplayHeader) == 32, "FPReplayHeader must be 32 bytes");
+static_assert(sizeof(FPReplayPrimary) == 72, "FPReplayPrimary must be 72 bytes");
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPPrimaryReplayFile
+{
+public:
+  /// Returns the shared read-only mapping of the given file. The file is
+  /// opened and validated once per process; later calls (from any thread)
+  /// return the same object. Returns nullptr if the file can not be used.
+  static const FPPrimaryReplayFile* Get(const G4String& fileName);
+
+  std::uint64_t GetNumberOfEvents() const    { return fHeader->nEvents; }
+  std::uint64_t GetNumberOfPrimaries() const { return fHeader->nPrimaries; }
+
+  /// Primaries of one event: a pointer into the mapping and their count.
+  /// No copies and no locks, safe to call concurrently.
+  inline const FPReplayPrimary* GetEvent(std::uint64_t eventID, std::size_t& nPrimaries) const;
+
+  const G4String& GetFileName() const { return fFileName; }
+
+  /// Write a replay file; eventIndex has nEvents+1 entries, as in the file
+  static G4bool Write(const G4String& fileName, const std::vector<std::uint64_t>& eventIndex,
+		      const std::vector<FPReplayPrimary>& primaries);
+
+private:
+  FPPrimaryReplayFile(const G4String& fileName);
+  ~FPPrimaryReplayFile();
+
+  G4bool Map();
+
+  G4String               fFileName;
+  void*                  fMapping;
+  std::size_t            fMappingSize;
+  const FPReplayHeader*  fHeader;
+  const std::uint64_t*   fEventIndex;
+  const FPReplayPrimary* fPrimaries;
+
+  friend struct FPPrimaryReplayRegistry;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline const FPReplayPrimary*
+FPPrimaryReplayFile::GetEvent(std::uint64_t eventID, std::size_t& nPrimaries) const
+{
+  if (eventID >= fHeader->nEvents) {
+    nPrimaries = 0;
+    return nullptr;
+  }
+  std::uint64_t first = fEventIndex[eventID];
+  nPrimaries = fEventIndex[eventID+1] - first;
+  return fPrimaries + first;
+}
+
+#endif
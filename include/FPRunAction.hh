@@ -5,14 +5,51 @@
 /// Updated: July 24, 2020 hexc, Nadia and Zachary
 ///         Cleaned up the code and added total photon counts at the end of Run
 ///
+/// October 19, 2026: Refresh the stepping action dispatch lists at the beginning of each run.
+///                   Own the spatial maps and photon fates of the thread.
+///                   Mergeable mean/variance of the light yield and eLoss per event,
+///                   and the run control (auto-stop). Checkpoint and resume.
+///                   Own the SiPM digitizer, the raw hit stream and the trajectory
+///                   filter of the thread.
+///                   Own the coincidence trigger, the readout time gate and the photon
+///                   limiter of the thread.
+/// October 19, 2026: The histograms are booked once per job, and copied by the master at the
+///                   end of each run for the in-process API (see FPSimulation).
+///
 
 #ifndef FPRunAction_h
 #define FPRunAction_h 1
 
 #include "G4UserRunAction.hh"
 #include "G4Accumulable.hh"
+#include "FPWelford.hh"
+#include "FPCheckpoint.hh"
 #include "globals.hh"
 
+#include <vector>
+
+class FPSteppingAction;
+class FPSpatialMaps;
+class FPPhotonFates;
+class FPSiPMDigitizer;
+class FPHitStream;
+class FPTrajectoryFilter;
+class FPCoincidenceTrigger;
+class FPTimeGate;
+class FPPhotonLimiter;
+
+/// Contents of a 1D histogram at the end of a run
+
+struct FPHistogram
+{
+  G4String name;
+  G4double xmin;
+  G4double xmax;
+  std::vector<G4double> counts;         // in range bins
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 /// Run action class
 
 class FPRunAction : public G4UserRunAction
@@ -25,9 +62,48 @@ class FPRunAction : public G4UserRunAction
     virtual void   EndOfRunAction(const G4Run*);
 
     void CountPhoton()           { fPhotons += 1; };
+    /// Summary of a completed event (histograms, statistics, checkpoint)
+    void FillEventStats(G4int eventID, G4int nPhotons, G4double eLoss);
+    void SetSteppingAction(FPSteppingAction* steppingAction) { fSteppingAction = steppingAction; }
+    FPSpatialMaps* GetSpatialMaps() const { return fSpatialMaps; }
+    FPPhotonFates* GetPhotonFates() const { return fPhotonFates; }
+    FPSiPMDigitizer* GetDigitizer() const { return fDigitizer; }
+    FPHitStream* GetHitStream() const { return fHitStream; }
+    FPTrajectoryFilter* GetTrajectoryFilter() const { return fTrajectoryFilter; }
+    FPCoincidenceTrigger* GetTrigger() const { return fTrigger; }
+    FPTimeGate* GetTimeGate() const { return fTimeGate; }
+    FPPhotonLimiter* GetPhotonLimiter() const { return fPhotonLimiter; }
+    /// Merged statistics of the last run (master)
+    const FPWelford& GetLightYield() const { return fLightYield.GetStats(); }
+    const FPWelford& GetELoss() const { return fELoss.GetStats(); }
+    G4int GetEventsWithPhotons() const { return fPhotons.GetValue(); }
+    const std::vector<FPHistogram>& GetHistograms() const { return fHistograms; }
+
+    /// The run histograms, also rebuilt from event records by fpMerge
+    static void BookHistograms();
+    static void FillHistograms(const FPEventRecord& record);
 
 private:
+    void FillEventSummary(const FPEventRecord& record);
+    void WriteCheckpoint();
+    void RestoreCheckpoint();
+    void RestoreCheckpointStates();
+    void SaveHistograms();
+
     G4Accumulable<G4int>    fPhotons;
+    FPWelfordAccumulable    fLightYield;         // detected photons per event
+    FPWelfordAccumulable    fELoss;              // eLoss per event
+    FPSteppingAction*       fSteppingAction;     // worker threads only
+    FPSpatialMaps*          fSpatialMaps;
+    FPPhotonFates*          fPhotonFates;
+    FPSiPMDigitizer*        fDigitizer;
+    FPHitStream*            fHitStream;
+    FPTrajectoryFilter*     fTrajectoryFilter;
+    FPCoincidenceTrigger*   fTrigger;
+    FPTimeGate*             fTimeGate;
+    FPPhotonLimiter*        fPhotonLimiter;
+    FPCheckpointShard       fCheckpointShard;    // events of this thread in the current run
+    std::vector<FPHistogram> fHistograms;        // master, last run
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
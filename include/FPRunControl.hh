@@ -0,0 +1,102 @@
+/// October 19, 2026: Precision-driven and time-budgeted run control.
+///
+///    Instead of guessing the number of events of /run/beamOn, a run may stop
+///    by itself as soon as
+///      - the relative error on the mean light yield (detected photons per
+///        event), or on the efficiency (fraction of events with at least a
+///        given number of detected photons), is below a target, or
+///      - a wall-clock budget is used up,
+///    whichever comes first; the precision is trusted only after a minimum
+///    number of events, the time budget holds from the first event.
+///    /run/beamOn then gives the maximum number of events. Energy-loss-only
+///    runs have no photons: the precision targeted is then that of the mean
+///    eLoss.
+///
+///    One instance is shared by all threads. Each worker accumulates its
+///    events locally and merges them into the shared statistics every
+///    checkInterval events, under a mutex; when a criterion is met a stop
+///    flag is raised, and every worker soft-aborts its event loop at the end
+///    of its current event. Commands under /FP/run/ (master only).
+
+#ifndef FPRunControl_h
+#define FPRunControl_h 1
+
+#include "FPWelford.hh"
+#include "G4Threading.hh"
+#include "globals.hh"
+
+#include <atomic>
+#include <chrono>
+
+class FPRunControlMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPRunControl
+{
+public:
+  enum Quantity { kLightYield = 0, kEfficiency };
+  enum StopReason { kNotStopped = 0, kPrecisionReached, kTimeBudget };
+
+  static FPRunControl* Instance();
+  ~FPRunControl();
+
+  /// Master, beginning of run: reset the shared statistics and the clock
+  void BeginOfRun(G4bool eLossOnly = false);
+  /// Any thread, beginning of its run: forget the local statistics
+  void BeginOfThreadRun();
+  /// Any thread, end of each event. Returns true if the run should stop.
+  G4bool EndOfEvent(G4int nPhotons, G4double eLoss);
+  /// Any thread, end of its run: merge the events not merged yet
+  void EndOfThreadRun();
+  /// Master, end of run
+  void Print() const;
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)            { fEnabled = value; }
+  void SetQuantity(Quantity quantity)      { fQuantity = quantity; }
+  void SetTargetRelativeError(G4double v)  { fTargetRelError = v; }
+  void SetEfficiencyThreshold(G4int n)     { fEfficiencyThreshold = n; }
+  void SetTimeBudget(G4double seconds)     { fTimeBudget = seconds; }
+  void SetMinEvents(G4int n)               { fMinEvents = n; }
+  void SetCheckInterval(G4int n)           { fCheckInterval = n; }
+
+private:
+  FPRunControl();
+
+  void MergeLocal();
+  G4double GetElapsedSeconds() const;
+
+  // Configuration (set from the master UI, read by the workers)
+  G4bool   fEnabled;
+  Quantity fQuantity;
+  G4double fTargetRelError;
+  G4int    fEfficiencyThreshold;
+  G4double fTimeBudget;            // seconds, <= 0: none
+  G4int    fMinEvents;
+  G4int    fCheckInterval;
+
+  // Shared statistics, guarded by fMutex
+  G4Mutex   fMutex;
+  FPWelford fLightYield;
+  FPWelford fEfficiency;
+  FPWelford fELoss;
+  StopReason fStopReason;
+  G4bool     fELossOnly;             // current run has no photons: target the eLoss
+
+  std::atomic<G4bool> fStop;
+  std::chrono::steady_clock::time_point fStartTime;
+
+  // Events of the calling thread not merged yet
+  struct LocalStats {
+    FPWelford lightYield, efficiency, eLoss;
+    G4int     nEvents = 0;
+  };
+  static G4ThreadLocal LocalStats* fgLocal;
+
+  FPRunControlMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
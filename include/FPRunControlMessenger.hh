@@ -0,0 +1,43 @@
+/// October 19, 2026: Run control messenger.
+///
+///    Commands under /FP/run/.
+
+#ifndef FPRunControlMessenger_h
+#define FPRunControlMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPRunControl;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithADouble;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAnInteger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPRunControlMessenger: public G4UImessenger
+{
+public:
+  FPRunControlMessenger(FPRunControl*);
+  ~FPRunControlMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPRunControl*                FPControl;
+  G4UIdirectory*                   runDir;
+  G4UIcmdWithABool*            SetAutoStopCmd;
+  G4UIcmdWithAString*          SetTargetCmd;
+  G4UIcmdWithADouble*          SetTargetRelErrorCmd;
+  G4UIcmdWithAnInteger*        SetEfficiencyThresholdCmd;
+  G4UIcmdWithADoubleAndUnit*   SetTimeBudgetCmd;
+  G4UIcmdWithAnInteger*        SetMinEventsCmd;
+  G4UIcmdWithAnInteger*        SetCheckIntervalCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
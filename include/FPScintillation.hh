@@ -0,0 +1,81 @@
+/// October 19, 2026: Scintillation with batched photon generation.
+///
+///    A muon step in the panel yields hundreds of scintillation photons,
+///    which G4Scintillation samples one at a time, drawing its random
+///    numbers and looking up the emission spectrum (a binary search in the
+///    integral table) between the allocations of each track. With the
+///    batched generation on (/FP/optical/batchedScintillation), a step of a
+///    material with one emission component and no rise time is done in
+///    three passes:
+///      - the random numbers of all its photons in one call of the engine,
+///        exactly 6 per photon (energy, direction, polarization, position
+///        along the step, emission time), after the number of photons
+///        sampled as in G4Scintillation,
+///      - the photon energies from an inverse-CDF table of the spectrum and
+///        the kinematics, as loops over arrays the compiler can vectorize,
+///      - the tracks and dynamic particles, allocated one by one as by
+///        G4Scintillation, with the space for the secondaries reserved
+///        beforehand.
+///    The distributions are those of G4Scintillation, except for the photon
+///    energy, which is an approximation: the integral of the spectrum is
+///    inverted at kInverseBins (512) uniform steps per material, and the
+///    energy is interpolated linearly between them, while G4Scintillation
+///    inverts the integral at each photon. The two agree at the 513 points;
+///    between them the cumulative distribution differs by less than 1/512
+///    (the energy by less than the width of the step, largest in the tails
+///    of the spectrum). bench/scintillationBench measures both against the
+///    stock process. Any other case (several components, rise time, yields
+///    by particle type, track information) goes to G4Scintillation.
+///
+///    The process keeps the name and class of the stock one. The setting is
+///    read by each thread at the beginning of each run.
+
+#ifndef FPScintillation_h
+#define FPScintillation_h 1
+
+#include "G4Scintillation.hh"
+#include "globals.hh"
+
+#include <vector>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPScintillation : public G4Scintillation
+{
+public:
+  explicit FPScintillation(const G4String& processName = "Scintillation");
+  virtual ~FPScintillation();
+
+  virtual void BuildPhysicsTable(const G4ParticleDefinition& particle);
+  virtual G4VParticleChange* PostStepDoIt(const G4Track& track, const G4Step& step);
+
+  static const G4int kRandomsPerPhoton = 6;
+  static const G4int kInverseBins = 512;
+
+  /// Photon energies at the kInverseBins + 1 uniform steps of the integral
+  /// of the spectrum of a material, nullptr or empty where the batched
+  /// generation does not apply
+  const std::vector<G4double>* GetInverseCDF(std::size_t materialIndex) const
+  { return (materialIndex < fInverseCDF.size()) ? &fInverseCDF[materialIndex] : nullptr; }
+
+private:
+  G4VParticleChange* BatchedPostStepDoIt(const G4Track& track, const G4Step& step,
+					 G4int nPhotons, const std::vector<G4double>& inverseCDF);
+  /// Number of photons of the step, sampled as in G4Scintillation
+  G4int SampleNumberOfPhotons(const G4Step& step, const G4MaterialPropertiesTable* table) const;
+
+  G4bool fBatched;
+  G4int  fRunID;
+  G4int  fCreatorModelID;
+
+  // Photon energy at uniform steps of the integral of the spectrum, per material
+  std::vector<std::vector<G4double> > fInverseCDF;
+
+  // Work arrays of the batch, reused from step to step
+  std::vector<G4double> fRandoms;
+  std::vector<G4double> fEnergy, fPx, fPy, fPz, fEx, fEy, fEz, fFraction, fTime;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
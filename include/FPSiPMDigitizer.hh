@@ -0,0 +1,152 @@
+/// October 19, 2026: Digitization of the SiPM hits.
+///
+///    At the end of each event the photons collected by FPSiPMSD are turned
+///    into a SiPM signal:
+///      - photon detection efficiency,
+///      - mapping to the microcells of the sipmLV face (y-z plane),
+///      - dark counts, optical crosstalk to a neighbour cell, afterpulses,
+///      - microcell recovery (a cell fired again recovers exponentially,
+///        which saturates the response at high occupancy), gain spread,
+///    avalanches being processed in time order. The avalanche charges are
+///    binned on the sampling grid of the gate and convolved with the pulse
+///    shape into a waveform, from which the charge, the amplitude and the
+///    leading edge time are extracted. With a stack of panels the SiPM of
+///    each panel (hit channel) is digitized separately.
+///
+///    The buffers are allocated per thread at the beginning of the run: the
+///    cost of an event is O(n log n) in the avalanches for the time ordering
+///    and bounded by (gate samples x pulse samples) for the waveform,
+///    however many photons are detected.
+///
+///    The feature statistics, kept per channel, are merged as an accumulable
+///    and printed by the master. Commands under /FP/sipm/.
+
+#ifndef FPSiPMDigitizer_h
+#define FPSiPMDigitizer_h 1
+
+#include "G4VAccumulable.hh"
+#include "FPWelford.hh"
+#include "SiPMhit.hh"
+#include "globals.hh"
+
+#include <iosfwd>
+#include <vector>
+
+class FPSiPMDigitizerMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPSiPMDigitizer : public G4VAccumulable
+{
+public:
+  FPSiPMDigitizer();
+  virtual ~FPSiPMDigitizer();
+
+  /// The digitizer of the calling thread (nullptr before the run action exists)
+  static FPSiPMDigitizer* Instance() { return fgInstance; }
+
+  // G4VAccumulable
+  virtual void Merge(const G4VAccumulable& other);
+  virtual void Reset();
+
+  /// Microcell layout, pulse shape and buffers (beginning of run)
+  void BeginOfRun();
+  /// Digitize the hits of the current event on one channel, or all (calling thread)
+  void Digitize(const SiPMHitCollection* hits, G4int channel = -1);
+  /// Print the merged feature statistics (master, end of run)
+  void Print() const;
+
+  /// Checkpoint: save the statistics, and add saved ones to the current ones
+  void Save(std::ostream& out) const;
+  void Restore(std::istream& in);
+
+  // Features of the last digitized event
+  G4double GetCharge() const      { return fCharge; }       // p.e.
+  G4double GetAmplitude() const   { return fAmplitude; }    // p.e.
+  G4double GetTime() const        { return fTime; }         // < 0: below threshold
+  G4int    GetAvalanches() const  { return fNAvalanches; }
+  const std::vector<G4double>& GetWaveform() const { return fWaveform; }
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)             { fEnabled = value; }
+  void SetPDE(G4double value)               { fPDE = value; }
+  void SetCellPitch(G4double value)         { fCellPitch = value; }
+  void SetRecoveryTime(G4double value)      { fRecoveryTime = value; }
+  void SetCrosstalk(G4double value)         { fCrosstalk = value; }
+  void SetAfterpulse(G4double value)        { fAfterpulse = value; }
+  void SetAfterpulseTime(G4double value)    { fAfterpulseTime = value; }
+  void SetDarkRate(G4double value)          { fDarkRate = value; }
+  void SetGainSpread(G4double value)        { fGainSpread = value; }
+  void SetRiseTime(G4double value)          { fRiseTime = value; }
+  void SetFallTime(G4double value)          { fFallTime = value; }
+  void SetSampling(G4double value)          { fSampling = value; }
+  void SetGate(G4double value)              { fGate = value; }
+  void SetThreshold(G4double value)         { fThreshold = value; }
+
+private:
+  struct Avalanche {
+    G4double time;
+    G4int    cell;
+    G4int    type;
+    G4bool operator>(const Avalanche& other) const { return time > other.time; }
+  };
+  enum AvalancheType { kPhoton = 0, kDark, kCrosstalk, kAfterpulse, kNTypes };
+
+  // Feature statistics of one channel
+  struct ChannelStats {
+    FPWelford charge;
+    FPWelford amplitude;
+    FPWelford time;
+  };
+
+  void Push(G4double time, G4int cell, G4int type);
+  G4int RandomNeighbour(G4int cell) const;
+  void BuildWaveform();
+  void ExtractFeatures(G4int channel);
+  ChannelStats& GetChannelStats(G4int channel);
+
+  static G4ThreadLocal FPSiPMDigitizer* fgInstance;
+
+  // Settings
+  G4bool   fEnabled;
+  G4double fPDE;
+  G4double fCellPitch;
+  G4double fRecoveryTime;
+  G4double fCrosstalk;          // probability per avalanche
+  G4double fAfterpulse;         // probability per avalanche of full charge
+  G4double fAfterpulseTime;     // mean delay
+  G4double fDarkRate;
+  G4double fGainSpread;         // relative
+  G4double fRiseTime, fFallTime;
+  G4double fSampling;
+  G4double fGate;               // the gate starts at time 0
+  G4double fThreshold;          // p.e., leading edge
+
+  // Layout and per-thread buffers, set at the beginning of run
+  G4int    fNCellsY, fNCellsZ;
+  G4double fHalfY, fHalfZ;
+  std::vector<G4double> fPulse;            // pulse of 1 p.e., peak 1
+  G4double              fPulseIntegral;    // in samples
+  std::vector<G4double> fCellLastTime;
+  std::vector<G4int>    fCellEvent;        // event stamp of fCellLastTime
+  G4int                 fEventStamp;
+  std::vector<Avalanche> fQueue;           // min-heap on time
+  std::vector<G4double> fCharges;          // avalanche charge per sample
+  std::vector<G4double> fWaveform;
+
+  // Features of the last event
+  G4double fCharge;
+  G4double fAmplitude;
+  G4double fTime;
+  G4int    fNAvalanches;
+
+  // Run statistics
+  std::vector<ChannelStats> fChannelStats;   // index 0 also for the single SiPM
+  G4long    fTypeCounts[kNTypes];
+
+  FPSiPMDigitizerMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,48 @@
+/// October 19, 2026: SiPM digitization messenger.
+///
+///    Commands under /FP/sipm/.
+
+#ifndef FPSiPMDigitizerMessenger_h
+#define FPSiPMDigitizerMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPSiPMDigitizer;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADouble;
+class G4UIcmdWithADoubleAndUnit;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPSiPMDigitizerMessenger: public G4UImessenger
+{
+public:
+  FPSiPMDigitizerMessenger(FPSiPMDigitizer*);
+  ~FPSiPMDigitizerMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPSiPMDigitizer*             FPDigitizer;
+  G4UIdirectory*                   sipmDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithADouble*          SetPDECmd;
+  G4UIcmdWithADoubleAndUnit*   SetCellPitchCmd;
+  G4UIcmdWithADoubleAndUnit*   SetRecoveryTimeCmd;
+  G4UIcmdWithADouble*          SetCrosstalkCmd;
+  G4UIcmdWithADouble*          SetAfterpulseCmd;
+  G4UIcmdWithADoubleAndUnit*   SetAfterpulseTimeCmd;
+  G4UIcmdWithADoubleAndUnit*   SetDarkRateCmd;
+  G4UIcmdWithADouble*          SetGainSpreadCmd;
+  G4UIcmdWithADoubleAndUnit*   SetRiseTimeCmd;
+  G4UIcmdWithADoubleAndUnit*   SetFallTimeCmd;
+  G4UIcmdWithADoubleAndUnit*   SetSamplingCmd;
+  G4UIcmdWithADoubleAndUnit*   SetGateCmd;
+  G4UIcmdWithADouble*          SetThresholdCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
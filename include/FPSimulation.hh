@@ -0,0 +1,87 @@
+/// October 19, 2026: In-process simulation API.
+///
+///    The simulation as a library (fiberPanelCore): configure the geometry
+///    and the source, run N events and get the results back as a structure,
+///    in the same process, as many times as needed, without re-initializing:
+///
+///      FPSimulation simulation(4);                     // 4 threads
+///      simulation.SetFiberOffset(0, 5*cm);
+///      simulation.SetSource(1, G4ThreeVector(0, 0, 2*cm));
+///      FPRunResults results = simulation.Run(1000);
+///
+///    Geometry changes after the first run rebuild the geometry at the next
+///    run; anything else is reached through ApplyCommand() (any UI command).
+///    Only one instance may exist, as there is one run manager per process.
+
+#ifndef FPSimulation_h
+#define FPSimulation_h 1
+
+#include "FPRunAction.hh"
+#include "G4ThreeVector.hh"
+#include "globals.hh"
+
+#include <vector>
+
+class G4RunManager;
+class G4VModularPhysicsList;
+class FPDetectorConstruction;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// Results of a run
+
+struct FPRunResults
+{
+  G4int    nEvents = 0;
+  G4int    nEventsWithPhotons = 0;
+  G4double lightYield = 0.;             // detected photons per event
+  G4double lightYieldError = 0.;
+  G4double lightYieldRMS = 0.;
+  G4double eLoss = 0.;                  // per event
+  G4double eLossError = 0.;
+  G4double seconds = 0.;                // wall-clock time of the run
+  std::vector<FPHistogram> histograms;  // nPhotons, eLoss
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPSimulation
+{
+public:
+  /// nThreads > 0: multi-threaded run manager, otherwise sequential
+  explicit FPSimulation(G4int nThreads = 0);
+  ~FPSimulation();
+
+  /// Reference physics list (PHYSLIST, FTFP_BERT by default) with the optical
+  /// and the fast simulation physics; also used by fiberPanel
+  static G4VModularPhysicsList* CreatePhysicsList();
+
+  /// Any UI command; returns the G4UImanager status (0: success)
+  G4int ApplyCommand(const G4String& command);
+  /// Done by the first run if not called
+  void Initialize();
+
+  // Geometry
+  void SetNumberOfPanels(G4int n);
+  void SetPanelSpacing(G4double spacing);
+  void SetPanelThickness(G4double thickness);
+  void SetFiberOffset(G4int panel, G4double offset);
+
+  // Source: particle type of /FP/gun/particleType (0: optical photon, 1: mu-, 2: replay)
+  void SetSource(G4int particleType, const G4ThreeVector& position);
+
+  FPRunResults Run(G4int nEvents);
+
+  G4RunManager* GetRunManager() const { return fRunManager; }
+
+private:
+  void GeometryModified();
+
+  G4RunManager*           fRunManager;
+  FPDetectorConstruction* fDetector;
+  G4bool                  fInitialized;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
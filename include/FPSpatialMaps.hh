@@ -0,0 +1,122 @@
+/// October 19, 2026: Spatial maps of the light production and energy loss.
+///
+///    Dense 3D voxel arrays over the box of PanelLV, one set per thread:
+///      - energy deposit,
+///      - scintillation photons produced (at their emission point),
+///      - origins of the photons detected by the SiPM,
+///    and the energy loss per detector component (panel, epoxy, cladding,
+///    fiber, wrapping, SiPM). The maps are accumulables: the worker maps are
+///    merged into the master ones at the end of the run and written as
+///    compact binary arrays (see Write()).
+///
+///    Commands under /FP/maps/ (see FPSpatialMapsMessenger).
+
+#ifndef FPSpatialMaps_h
+#define FPSpatialMaps_h 1
+
+#include "G4VAccumulable.hh"
+#include "FPVolumeComponents.hh"
+#include "G4ThreeVector.hh"
+#include "globals.hh"
+
+#include <cmath>
+#include <iosfwd>
+#include <vector>
+
+class FPStepConsumer;
+class FPSpatialMapsMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPSpatialMaps : public G4VAccumulable
+{
+public:
+  FPSpatialMaps();
+  virtual ~FPSpatialMaps();
+
+  /// The maps of the calling thread (nullptr before the run action exists)
+  static FPSpatialMaps* Instance() { return fgInstance; }
+
+  // G4VAccumulable
+  virtual void Merge(const G4VAccumulable& other);
+  virtual void Reset();
+
+  /// Size the arrays and resolve the volumes (beginning of run)
+  void BeginOfRun();
+  /// Write the merged maps (master, end of run)
+  void Write() const;
+
+  /// Checkpoint: save the maps, and add saved maps to the current ones
+  /// (maps not sized by BeginOfRun() take the saved binning)
+  void Save(std::ostream& out) const;
+  void Restore(std::istream& in);
+
+  /// Step consumer filling the energy deposit maps, owned by the caller
+  FPStepConsumer* CreateStepConsumer();
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value) { fEnabled = value; }
+  void SetBins(G4int nx, G4int ny, G4int nz) { fNx = nx; fNy = ny; fNz = nz; }
+  void SetFileName(const G4String& fileName) { fFileName = fileName; }
+
+  // Filling, from the calling thread only and when enabled
+  inline void AddEnergyDeposit(const G4ThreeVector& position, G4double edep,
+			       const G4LogicalVolume* volume);
+  inline void AddScintillationPhoton(const G4ThreeVector& origin);
+  inline void AddDetectedPhoton(const G4ThreeVector& origin);
+
+private:
+  inline G4int VoxelIndex(const G4ThreeVector& position) const;
+
+  static G4ThreadLocal FPSpatialMaps* fgInstance;
+
+  G4bool   fEnabled;
+  G4int    fNx, fNy, fNz;
+  G4String fFileName;
+  G4ThreeVector fHalfSize;           // of the panel box
+  G4ThreeVector fInvVoxelSize;
+
+  std::vector<G4double> fEdep;
+  std::vector<G4double> fScintPhotons;
+  std::vector<G4double> fDetectedOrigins;
+  G4double fComponentELoss[FPVolumeComponents::kNComponents];
+
+  FPVolumeComponents fComponents;
+
+  FPSpatialMapsMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline G4int FPSpatialMaps::VoxelIndex(const G4ThreeVector& position) const
+{
+  // floor, not truncation: positions just below the box must not land in voxel 0
+  G4int ix = (G4int) std::floor((position.x() + fHalfSize.x())*fInvVoxelSize.x());
+  G4int iy = (G4int) std::floor((position.y() + fHalfSize.y())*fInvVoxelSize.y());
+  G4int iz = (G4int) std::floor((position.z() + fHalfSize.z())*fInvVoxelSize.z());
+  if (ix < 0 || ix >= fNx || iy < 0 || iy >= fNy || iz < 0 || iz >= fNz) return -1;
+  return (iz*fNy + iy)*fNx + ix;
+}
+
+inline void FPSpatialMaps::AddEnergyDeposit(const G4ThreeVector& position, G4double edep,
+					    const G4LogicalVolume* volume)
+{
+  fComponentELoss[fComponents.Get(volume)] += edep;
+
+  G4int voxel = VoxelIndex(position);
+  if (voxel >= 0) fEdep[voxel] += edep;
+}
+
+inline void FPSpatialMaps::AddScintillationPhoton(const G4ThreeVector& origin)
+{
+  G4int voxel = VoxelIndex(origin);
+  if (voxel >= 0) fScintPhotons[voxel] += 1.;
+}
+
+inline void FPSpatialMaps::AddDetectedPhoton(const G4ThreeVector& origin)
+{
+  G4int voxel = VoxelIndex(origin);
+  if (voxel >= 0) fDetectedOrigins[voxel] += 1.;
+}
+
+#endif
@@ -0,0 +1,37 @@
+/// October 19, 2026: Spatial maps messenger.
+///
+///    Commands under /FP/maps/.
+
+#ifndef FPSpatialMapsMessenger_h
+#define FPSpatialMapsMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPSpatialMaps;
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPSpatialMapsMessenger: public G4UImessenger
+{
+public:
+  FPSpatialMapsMessenger(FPSpatialMaps*);
+  ~FPSpatialMapsMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPSpatialMaps*               FPMaps;
+  G4UIdirectory*                   mapsDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcommand*                 SetBinsCmd;
+  G4UIcmdWithAString*          SetFileNameCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
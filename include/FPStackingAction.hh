@@ -1,6 +1,11 @@
 /// This code was created based on B3a example
 /// Date created: May 27, 2020
 /// Authors: hexc. Zachary Langford and Nadia Qutob
+///
+/// October 19, 2026: Staged tracking of the optical photons for the coincidence
+///                   trigger of the panel stack (see FPCoincidenceTrigger).
+/// October 19, 2026: Peak number of stacked tracks, for the optical physics benchmark.
+/// October 19, 2026: Peak numbers of urgent and waiting tracks, for the memory report.
 
 #ifndef FPStackingAction_h
 #define FPStackingAction_h 1
@@ -8,10 +13,16 @@
 #include "G4UserStackingAction.hh"
 #include "globals.hh"
 
+class G4Track;
+
 /// Stacking action class : manage the newly generated particles
 ///
 /// One wishes do not track secondary neutrino.Therefore one kills it 
 /// immediately, before created particles will  put in a stack.
+///
+/// With the coincidence trigger on, the optical photons wait until the
+/// charged particles are tracked, then are tracked panel by panel; those
+/// left are killed once the trigger cannot fire any more.
 
 class FPStackingAction : public G4UserStackingAction
 {
@@ -20,9 +31,24 @@ class FPStackingAction : public G4UserStackingAction
     virtual ~FPStackingAction();
      
     virtual G4ClassificationOfNewTrack ClassifyNewTrack(const G4Track*);        
+    virtual void NewStage();
+    virtual void PrepareNewEvent();
+
+    /// Largest number of tracks waiting in the stacks since the last reset
+    G4int GetPeakStackedTracks() const { return fPeakStackedTracks; }
+    G4int GetPeakUrgentTracks() const  { return fPeakUrgentTracks; }
+    G4int GetPeakWaitingTracks() const { return fPeakWaitingTracks; }
+    void ResetPeakStackedTracks() { fPeakStackedTracks = fPeakUrgentTracks = fPeakWaitingTracks = 0; }
+
+  private:
+    /// Panel (module copy number) where the track is, -1 outside the panels
+    G4int PanelOf(const G4Track* track) const;
+
+    G4int fPeakStackedTracks;
+    G4int fPeakUrgentTracks;
+    G4int fPeakWaitingTracks;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 #endif
-
@@ -0,0 +1,53 @@
+/// October 19, 2026: Consumer of steps dispatched by FPSteppingAction.
+///
+///    Every piece of per-step instrumentation is a consumer declaring which
+///    particles it wants (optical photons and/or everything else), the
+///    logical volumes it wants them in (all by default) and whether it needs
+///    the logical volume of the step. FPSteppingAction builds its dispatch
+///    lists from the consumers active for the run, so that a step nobody is
+///    interested in (an optical photon, usually) costs one pointer comparison.
+
+#ifndef FPStepConsumer_h
+#define FPStepConsumer_h 1
+
+#include "globals.hh"
+
+#include <vector>
+
+class G4Step;
+class G4LogicalVolume;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPStepConsumer
+{
+public:
+  FPStepConsumer(G4bool opticalPhotons, G4bool otherParticles, G4bool needsVolume)
+    : fOpticalPhotons(opticalPhotons), fOtherParticles(otherParticles),
+      fNeedsVolume(needsVolume) {}
+  virtual ~FPStepConsumer() {}
+
+  /// Evaluated at the beginning of each run, not at each step
+  virtual G4bool IsActive() const { return true; }
+
+  /// Volumes whose steps the consumer receives, empty for every volume.
+  /// Evaluated at the beginning of each run, like IsActive()
+  virtual std::vector<const G4LogicalVolume*> GetVolumes() const { return {}; }
+
+  /// The volume is the pre-step logical volume, or nullptr if no active
+  /// consumer of this particle class asked for it or registered by volume
+  virtual void ProcessStep(const G4Step* step, const G4LogicalVolume* volume) = 0;
+
+  G4bool WantsOpticalPhotons() const  { return fOpticalPhotons; }
+  G4bool WantsOtherParticles() const  { return fOtherParticles; }
+  G4bool NeedsVolume() const          { return fNeedsVolume; }
+
+private:
+  G4bool fOpticalPhotons;
+  G4bool fOtherParticles;
+  G4bool fNeedsVolume;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
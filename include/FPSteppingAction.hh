@@ -1,20 +1,31 @@
 // Aug 5, 2020: Hexc and Zachary
 //
 // Add stepping action to track energy loss of the primary particle energy loss.
+//
+// October 19, 2026: Restructured into a dispatcher of step consumers (FPStepConsumer).
+//                   Steps are routed by particle class; optical photons are skipped unless
+//                   some active consumer asked for them.
+//                   Consumers may register for some logical volumes only.
 
 #ifndef FPSteppingAction_h
 #define FPSteppingAction_h 1
 
 #include "G4UserSteppingAction.hh"
+#include "FPStepConsumer.hh"
+
+#include <utility>
+#include <vector>
 
 class FPDetectorConstruction;
 class FPEventAction;
+class G4ParticleDefinition;
 
 /// Stepping action class.
 ///
-/// In UserSteppingAction() there are collected the energy deposit and track 
-/// lengths of charged particles in Absober and Gap layers and
-/// updated in B4aEventAction.
+/// UserSteppingAction() dispatches the step to the consumers registered for
+/// its particle class, in any volume or in the pre-step volume. The energy loss summed by FPEventAction is the
+/// default consumer, for all particles but optical photons (which never
+/// deposit energy).
 
 class FPSteppingAction : public G4UserSteppingAction
 {
@@ -23,9 +34,34 @@ public:
   virtual ~FPSteppingAction();
 
   virtual void UserSteppingAction(const G4Step* step);
+
+  /// The stepping action takes ownership of the consumer
+  void RegisterConsumer(FPStepConsumer* consumer);
+
+  /// Rebuild the dispatch lists from the active consumers (begin of run)
+  void UpdateConsumers();
+
+  G4bool HasActiveConsumers() const
+  { return fOpticalDispatch.active || fOtherDispatch.active; }
     
 private:
+  // Dispatch lists of one particle class
+  struct Dispatch {
+    std::vector<FPStepConsumer*> consumers;                 // in every volume
+    std::vector<std::pair<const G4LogicalVolume*, std::vector<FPStepConsumer*> > > byVolume;
+    G4bool needsVolume = false;
+    G4bool active = false;
+
+    void Clear() { consumers.clear(); byVolume.clear(); needsVolume = false; active = false; }
+    void Add(FPStepConsumer* consumer);
+  };
+
   FPEventAction*  fEventAction;  
+
+  const G4ParticleDefinition*  fOpticalPhoton;
+  std::vector<FPStepConsumer*> fConsumers;
+  Dispatch fOpticalDispatch;
+  Dispatch fOtherDispatch;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,111 @@
+/// October 19, 2026: Live run telemetry.
+///
+///    A status file, rewritten every few seconds while a run goes on, for
+///    scripts watching many jobs of a node without parsing their logs:
+///    events done (total and per thread), events, optical steps and
+///    detected photons per second over the last interval, the mean light
+///    yield with its error, and the estimated time to the end of the run
+///    (/run/beamOn; with /FP/run/autoStop, to the maximum). The events cut
+///    short by the coincidence trigger count as done, not in the light yield. The file is
+///    written to a temporary then renamed, so a reader never sees a partial
+///    one; its last version has "state": "done".
+///
+///    The workers never lock: each one counts in thread-local variables and
+///    publishes its totals at the end of each event with relaxed atomic
+///    stores into its own slot (one cache line per thread). A thread of the
+///    master reads the slots and writes the file. Commands under
+///    /FP/telemetry/ (master only).
+
+#ifndef FPTelemetry_h
+#define FPTelemetry_h 1
+
+#include "G4Threading.hh"
+#include "globals.hh"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
+class FPTelemetryMessenger;
+class FPStepConsumer;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTelemetry
+{
+public:
+  static FPTelemetry* Instance();
+  ~FPTelemetry();
+
+  /// Master, beginning of run: clear the slots and start the writer thread
+  void BeginOfRun(G4int runID, G4int nEventsRequested);
+  /// Any thread, beginning of its run
+  void BeginOfThreadRun();
+  /// Any thread, end of each event (nPhotons < 0: not counted)
+  void EndOfEvent(G4int nPhotons);
+  /// Master, end of run: stop the writer thread and write the final status
+  void EndOfRun();
+
+  /// Counts the optical photon steps of the calling thread
+  FPStepConsumer* CreateStepConsumer();
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)            { fEnabled = value; }
+  void SetFileName(const G4String& name)   { fFileName = name; }
+  void SetInterval(G4double seconds)       { fInterval = seconds; }
+
+private:
+  FPTelemetry();
+
+  void WriterLoop();
+  void WriteStatus(G4bool done);
+
+  // Configuration (set from the master UI, read by the workers)
+  G4bool   fEnabled;
+  G4String fFileName;
+  G4double fInterval;         // seconds between two updates
+
+  // Totals of each thread since the beginning of its run: one writer each
+  struct alignas(64) Slot {
+    std::atomic<G4long>   events{0};
+    std::atomic<G4long>   measured{0};      // events with a photon count
+    std::atomic<G4long>   photons{0};
+    std::atomic<G4double> photons2{0.};
+    std::atomic<G4long>   opticalSteps{0};
+  };
+  static const G4int kMaxSlots = 1024;
+  Slot fSlots[kMaxSlots];
+  G4int fNSlots;
+
+  struct LocalCounts {
+    G4long   events;
+    G4long   measured;
+    G4long   photons;
+    G4double photons2;
+    G4long   opticalSteps;
+  };
+  static G4ThreadLocal LocalCounts fgLocal;
+  static G4ThreadLocal G4int fgSlot;
+
+  // Run and writer thread (master)
+  G4int fRunID;
+  G4int fNEventsRequested;
+  std::chrono::steady_clock::time_point fStartTime;
+  std::thread fWriter;
+  G4Mutex fWriterMutex;
+  std::condition_variable fWakeUp;
+  G4bool fStopWriter;             // guarded by fWriterMutex
+
+  // Totals at the previous update, for the rates
+  G4double fLastTime;
+  G4long   fLastEvents;
+  G4long   fLastSteps;
+  G4long   fLastPhotons;
+
+  FPTelemetryMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,37 @@
+/// October 19, 2026: Run telemetry messenger.
+///
+///    Commands under /FP/telemetry/.
+
+#ifndef FPTelemetryMessenger_h
+#define FPTelemetryMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPTelemetry;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithADoubleAndUnit;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTelemetryMessenger: public G4UImessenger
+{
+public:
+  FPTelemetryMessenger(FPTelemetry*);
+  ~FPTelemetryMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPTelemetry*                 FPStatus;
+  G4UIdirectory*                   telemetryDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithAString*          SetFileNameCmd;
+  G4UIcmdWithADoubleAndUnit*   SetIntervalCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,83 @@
+/// October 19, 2026: Readout time gate.
+///
+///    The SiPM integrates the light in a window [start, start + width) of
+///    global time. With the gate on:
+///      - FPSiPMSD drops the hits outside the window,
+///      - an optical photon whose global time passes the end of the window
+///        is killed at the end of its current step (a step consumer of
+///        optical photons), its fate being "killed". The long tails of
+///        photons reflected in the wrapped panel are not tracked any more.
+///    The numbers of killed photons, of their path length after the end of
+///    the window and of dropped hits are merged as an accumulable and
+///    printed by the master.
+///
+///    One instance per thread, owned by the run action. Commands under /FP/gate/.
+
+#ifndef FPTimeGate_h
+#define FPTimeGate_h 1
+
+#include "G4VAccumulable.hh"
+#include "globals.hh"
+
+#include <iosfwd>
+
+class FPStepConsumer;
+class FPTimeGateMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTimeGate : public G4VAccumulable
+{
+public:
+  FPTimeGate();
+  virtual ~FPTimeGate();
+
+  /// The gate of the calling thread (nullptr before the run action exists)
+  static FPTimeGate* Instance() { return fgInstance; }
+
+  // G4VAccumulable
+  virtual void Merge(const G4VAccumulable& other);
+  virtual void Reset();
+
+  /// Step consumer killing the late optical photons; owned by the stepping action
+  FPStepConsumer* CreateStepConsumer();
+
+  G4bool Contains(G4double time) const { return time >= fStart && time < fEnd; }
+  G4double GetEnd() const { return fEnd; }
+
+  void AddKilledPhoton(G4double lateLength) { fNKilled++; fLateLength += lateLength; }
+  void AddDroppedHit() { fNDropped++; }
+  /// Print the merged counts (master, end of run)
+  void Print() const;
+
+  /// Checkpoint: save the counts, and add saved ones to the current ones.
+  /// The gate of the macro is kept (with a warning if the saved one differs)
+  /// unless takeSettings is set, for a report of merged jobs (fpMerge)
+  void Save(std::ostream& out) const;
+  void Restore(std::istream& in, G4bool takeSettings = false);
+
+  G4bool IsEnabled() const { return fEnabled; }
+  void SetEnabled(G4bool value)       { fEnabled = value; }
+  void SetStart(G4double value)       { fStart = value; fEnd = fStart + fWidth; }
+  void SetWidth(G4double value)       { fWidth = value; fEnd = fStart + fWidth; }
+
+private:
+  static G4ThreadLocal FPTimeGate* fgInstance;
+
+  // Settings
+  G4bool   fEnabled;
+  G4double fStart;
+  G4double fWidth;
+  G4double fEnd;
+
+  // Run counts
+  G4long   fNKilled;
+  G4double fLateLength;         // travelled by the killed photons after the end of the gate
+  G4long   fNDropped;
+
+  FPTimeGateMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
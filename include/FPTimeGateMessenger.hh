@@ -0,0 +1,36 @@
+/// October 19, 2026: Readout time gate messenger.
+///
+///    Commands under /FP/gate/.
+
+#ifndef FPTimeGateMessenger_h
+#define FPTimeGateMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPTimeGate;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADoubleAndUnit;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTimeGateMessenger: public G4UImessenger
+{
+public:
+  FPTimeGateMessenger(FPTimeGate*);
+  ~FPTimeGateMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPTimeGate*                  FPGate;
+  G4UIdirectory*                   gateDir;
+  G4UIcmdWithABool*            SetEnableCmd;
+  G4UIcmdWithADoubleAndUnit*   SetStartCmd;
+  G4UIcmdWithADoubleAndUnit*   SetWidthCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,73 @@
+/// October 19, 2026: User track information for optical photons.
+///
+///    Remembers where the scintillation photon at the origin of an optical
+///    photon was emitted. Photons re-emitted by WLS inherit the origin of the
+///    photon they were produced by, so a photon detected by the SiPM can be
+///    traced back to the point of the panel where the light was produced.
+///
+///    The fate of the photon may be set while it is tracked by whoever knows it
+///    best (the SiPM sensitive detector for detected photons); otherwise it is
+///    decided by FPPhotonFates from the last step.
+///
+///    October 19, 2026: Bounce and path length counters of the track, for the
+///    photon limiter (FPPhotonLimiter). They start from zero for the photons
+///    re-emitted by WLS.
+
+#ifndef FPTrackInformation_h
+#define FPTrackInformation_h 1
+
+#include "G4VUserTrackInformation.hh"
+#include "G4ThreeVector.hh"
+#include "G4Allocator.hh"
+#include "globals.hh"
+
+class FPTrackInformation : public G4VUserTrackInformation
+{
+public:
+  FPTrackInformation(const G4ThreeVector& origin);
+  FPTrackInformation(const FPTrackInformation* parent);
+  virtual ~FPTrackInformation();
+
+  inline void *operator new(size_t);
+  inline void operator delete(void *info);
+
+  virtual void Print() const;
+
+  const G4ThreeVector& GetOrigin() const { return fOrigin; }
+
+  void  SetFate(G4int fate) { fFate = fate; }
+  G4int GetFate() const     { return fFate; }
+
+  void AddBounce()                    { fBounces++; }
+  void AddPathLength(G4double length) { fPathLength += length; }
+  void SetRouletteLevel(G4int level)  { fRouletteLevel = level; }
+  G4int    GetBounces() const       { return fBounces; }
+  G4double GetPathLength() const    { return fPathLength; }
+  G4int    GetRouletteLevel() const { return fRouletteLevel; }
+
+private:
+  G4ThreeVector fOrigin;        // emission point of the original scintillation photon
+  G4int         fFate;          // FPPhotonFates::Fate, -1 until known
+  G4int         fBounces;       // reflections at boundaries and surfaces
+  G4double      fPathLength;
+  G4int         fRouletteLevel; // limits already survived
+};
+
+//  -- new and delete overloaded operators (one allocator per thread):
+
+extern G4ThreadLocal G4Allocator<FPTrackInformation>* FPTrackInformationAllocator;
+
+inline void* FPTrackInformation::operator new(size_t)
+{
+  if (!FPTrackInformationAllocator) {
+    FPTrackInformationAllocator = new G4Allocator<FPTrackInformation>;
+  }
+  return (void *) FPTrackInformationAllocator->MallocSingle();
+}
+
+inline void FPTrackInformation::operator delete(void *info)
+{
+  FPTrackInformationAllocator->FreeSingle((FPTrackInformation*) info);
+}
+
+#endif
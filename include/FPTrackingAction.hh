@@ -0,0 +1,37 @@
+/// October 19, 2026: Tracking action.
+///
+///    Gives the optical photons their FPTrackInformation (the emission point
+///    of the scintillation photon they come from) and passes it on to the
+///    optical secondaries, and counts the scintillation photons produced in
+///    the spatial maps. Finished optical photons are classified by FPPhotonFates.
+///    With trajectory thinning on (FPTrajectoryFilter), stores downsampled
+///    FPTrajectory objects and drops those of the photons not kept.
+
+#ifndef FPTrackingAction_h
+#define FPTrackingAction_h 1
+
+#include "G4UserTrackingAction.hh"
+#include "globals.hh"
+
+class G4ParticleDefinition;
+class G4VProcess;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTrackingAction : public G4UserTrackingAction
+{
+public:
+  FPTrackingAction();
+  virtual ~FPTrackingAction();
+
+  virtual void PreUserTrackingAction(const G4Track*);
+  virtual void PostUserTrackingAction(const G4Track*);
+
+private:
+  const G4ParticleDefinition* fOpticalPhoton;
+  const G4VProcess*           fScintillation;     // looked up at the first optical photon
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
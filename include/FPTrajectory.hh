@@ -0,0 +1,72 @@
+/// October 19, 2026: Downsampled trajectory.
+///
+///    Stores the vertex, then a step end point only when it is at least a
+///    given distance from the last stored point, and always the end point of
+///    the track. Photons bouncing thousands of times along the fiber and
+///    finely stepped charged tracks are drawn with a few points each.
+
+#ifndef FPTrajectory_h
+#define FPTrajectory_h 1
+
+#include "G4VTrajectory.hh"
+#include "G4TrajectoryPoint.hh"
+#include "G4ThreeVector.hh"
+#include "G4Allocator.hh"
+#include "globals.hh"
+
+#include <vector>
+
+class G4Track;
+class G4ParticleDefinition;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTrajectory : public G4VTrajectory
+{
+public:
+  FPTrajectory(const G4Track* track, G4double minPointDistance);
+  virtual ~FPTrajectory();
+
+  inline void *operator new(size_t);
+  inline void operator delete(void *trajectory);
+
+  // G4VTrajectory
+  virtual G4int GetTrackID() const                  { return fTrackID; }
+  virtual G4int GetParentID() const                 { return fParentID; }
+  virtual G4String GetParticleName() const;
+  virtual G4double GetCharge() const;
+  virtual G4int GetPDGEncoding() const;
+  virtual G4ThreeVector GetInitialMomentum() const  { return fInitialMomentum; }
+  virtual G4int GetPointEntries() const             { return fPoints.size(); }
+  virtual G4VTrajectoryPoint* GetPoint(G4int i) const { return fPoints[i]; }
+  virtual void AppendStep(const G4Step* step);
+  virtual void MergeTrajectory(G4VTrajectory* secondTrajectory);
+
+private:
+  std::vector<G4TrajectoryPoint*> fPoints;
+  G4ThreeVector fLastPoint;
+  G4double      fMinDistance2;
+  G4int         fTrackID;
+  G4int         fParentID;
+  const G4ParticleDefinition* fParticle;
+  G4ThreeVector fInitialMomentum;
+};
+
+//  -- new and delete overloaded operators (one allocator per thread):
+
+extern G4ThreadLocal G4Allocator<FPTrajectory>* FPTrajectoryAllocator;
+
+inline void* FPTrajectory::operator new(size_t)
+{
+  if (!FPTrajectoryAllocator) FPTrajectoryAllocator = new G4Allocator<FPTrajectory>;
+  return (void *) FPTrajectoryAllocator->MallocSingle();
+}
+
+inline void FPTrajectory::operator delete(void *trajectory)
+{
+  FPTrajectoryAllocator->FreeSingle((FPTrajectory*) trajectory);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
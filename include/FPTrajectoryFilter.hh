@@ -0,0 +1,61 @@
+/// October 19, 2026: Trajectory thinning for visualization sessions.
+///
+///    When trajectories are stored (vis.mac, /tracking/storeTrajectory) a
+///    muon event would keep one trajectory per optical photon. With thinning
+///    on, the tracking action stores FPTrajectory (downsampled points) and,
+///    at the end of each optical photon, drops its trajectory unless
+///      - the photon reached the SiPM, or is a primary, or
+///      - it is in the sampled fraction of the photons and the number of
+///        sampled photons of the event is below the cap.
+///    Trajectories of the other particles are always kept. The sampling is
+///    a hash of the track ID, so it does not use the random engine: the
+///    simulated events are the same with and without thinning.
+///
+///    One instance per thread, owned by the run action. Commands under /FP/vis/.
+
+#ifndef FPTrajectoryFilter_h
+#define FPTrajectoryFilter_h 1
+
+#include "globals.hh"
+
+class FPTrajectoryFilterMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTrajectoryFilter
+{
+public:
+  FPTrajectoryFilter();
+  ~FPTrajectoryFilter();
+
+  /// The filter of the calling thread (nullptr before the run action exists)
+  static FPTrajectoryFilter* Instance() { return fgInstance; }
+
+  void BeginOfEvent() { fSampled = 0; }
+  /// End of an optical photon: keep its trajectory?
+  G4bool KeepPhoton(G4int trackID, G4int parentID, G4bool detected);
+
+  G4bool IsEnabled() const { return fEnabled; }
+  G4double GetMinPointDistance() const { return fMinPointDistance; }
+
+  void SetEnabled(G4bool value)             { fEnabled = value; }
+  void SetPhotonFraction(G4double value)    { fPhotonFraction = value; }
+  void SetMaxPhotons(G4int value)           { fMaxPhotons = value; }
+  void SetMinPointDistance(G4double value)  { fMinPointDistance = value; }
+
+private:
+  static G4ThreadLocal FPTrajectoryFilter* fgInstance;
+
+  G4bool   fEnabled;
+  G4double fPhotonFraction;
+  G4int    fMaxPhotons;          // sampled photons per event
+  G4double fMinPointDistance;
+
+  G4int fSampled;
+
+  FPTrajectoryFilterMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,39 @@
+/// October 19, 2026: Trajectory thinning messenger.
+///
+///    Commands under /FP/vis/.
+
+#ifndef FPTrajectoryFilterMessenger_h
+#define FPTrajectoryFilterMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class FPTrajectoryFilter;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADouble;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADoubleAndUnit;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPTrajectoryFilterMessenger: public G4UImessenger
+{
+public:
+  FPTrajectoryFilterMessenger(FPTrajectoryFilter*);
+  ~FPTrajectoryFilterMessenger();
+
+  void SetNewValue(G4UIcommand*, G4String);
+
+private:
+  FPTrajectoryFilter*          FPFilter;
+  G4UIdirectory*                   visDir;
+  G4UIcmdWithABool*            SetThinningCmd;
+  G4UIcmdWithADouble*          SetPhotonFractionCmd;
+  G4UIcmdWithAnInteger*        SetMaxPhotonsCmd;
+  G4UIcmdWithADoubleAndUnit*   SetMinPointDistanceCmd;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,41 @@
+/// October 19, 2026: Detector components of the logical volumes.
+///
+///    Maps a logical volume to the detector component it belongs to through
+///    a table indexed by the volume instance ID, built at the beginning of a
+///    run from the volume names, so that per-step accounting costs one load.
+
+#ifndef FPVolumeComponents_h
+#define FPVolumeComponents_h 1
+
+#include "G4LogicalVolume.hh"
+#include "globals.hh"
+
+#include <vector>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPVolumeComponents
+{
+public:
+  enum Component { kPanel = 0, kEpoxy, kCladding, kFiber, kWrapping, kSiPM, kOther, kNComponents };
+
+  /// Resolve the volumes of the current geometry
+  void Build();
+
+  inline G4int Get(const G4LogicalVolume* volume) const;
+
+  static const char* GetName(G4int component);
+
+private:
+  std::vector<G4int> fComponentOfVolume;    // indexed by logical volume instance ID
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline G4int FPVolumeComponents::Get(const G4LogicalVolume* volume) const
+{
+  G4int id = volume->GetInstanceID();
+  return (id < (G4int) fComponentOfVolume.size()) ? fComponentOfVolume[id] : kOther;
+}
+
+#endif
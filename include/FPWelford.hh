@@ -0,0 +1,81 @@
+/// October 19, 2026: Running mean and variance.
+///
+///    Welford's online algorithm: numerically stable single-pass mean and
+///    variance. Two sets of statistics are combined with the pairwise update
+///    of Chan et al., so the worker sums merge exactly into the master ones.
+
+#ifndef FPWelford_h
+#define FPWelford_h 1
+
+#include "G4VAccumulable.hh"
+#include "globals.hh"
+
+#include <cfloat>
+#include <cmath>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+class FPWelford
+{
+public:
+  FPWelford() : fN(0), fMean(0.), fM2(0.) {}
+
+  void Fill(G4double x)
+  {
+    fN++;
+    G4double delta = x - fMean;
+    fMean += delta/fN;
+    fM2 += delta*(x - fMean);
+  }
+
+  void Merge(const FPWelford& other)
+  {
+    if (other.fN == 0) return;
+    G4long n = fN + other.fN;
+    G4double delta = other.fMean - fMean;
+    fMean += delta*other.fN/n;
+    fM2 += other.fM2 + delta*delta*((G4double) fN*other.fN/n);
+    fN = n;
+  }
+
+  void Reset() { fN = 0; fMean = 0.; fM2 = 0.; }
+
+  G4long   GetN() const        { return fN; }
+  G4double GetMean() const     { return fMean; }
+  G4double GetVariance() const { return (fN > 1) ? fM2/(fN - 1) : 0.; }
+  G4double GetRMS() const      { return std::sqrt(GetVariance()); }
+  /// Error on the mean
+  G4double GetError() const    { return (fN > 1) ? std::sqrt(GetVariance()/fN) : 0.; }
+  /// Error on the mean relative to the mean, infinite while undefined
+  G4double GetRelativeError() const
+  { return (fN > 1 && fMean != 0.) ? GetError()/std::fabs(fMean) : DBL_MAX; }
+
+private:
+  G4long   fN;
+  G4double fMean;
+  G4double fM2;        // sum of squared deviations from the mean
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// Run accumulable of per-event values
+
+class FPWelfordAccumulable : public G4VAccumulable
+{
+public:
+  FPWelfordAccumulable(const G4String& name) : G4VAccumulable(name) {}
+
+  virtual void Merge(const G4VAccumulable& other)
+  { fStats.Merge(static_cast<const FPWelfordAccumulable&>(other).fStats); }
+  virtual void Reset() { fStats.Reset(); }
+
+  void Fill(G4double x) { fStats.Fill(x); }
+  const FPWelford& GetStats() const { return fStats; }
+
+private:
+  FPWelford fStats;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
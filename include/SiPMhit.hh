@@ -7,6 +7,11 @@
 ///        Hit position
 ///        photon energy
 ///
+/// October 19, 2026: Arrival time and position on the SiPM face, for the digitization.
+///                   The allocator is thread local. Photon energy and channel (SiPM copy
+///                   number), for the raw hit stream.
+///                   Weight of the photon (Russian roulette of FPPhotonLimiter).
+///
 ///     Followed an example from
 ///       https://www-zeuthen.desy.de/geant4/g4course2011/day3/5_sensitivedetector/SimpleHit_8hh-source.html
 
@@ -32,11 +37,28 @@ public:
 public:
   void AddPhotonCount()  { photonCounts += 1;}
   void SetPosition(const G4ThreeVector & pos) {position = pos;}
+  void SetLocalPosition(const G4ThreeVector & pos) {localPosition = pos;}
+  void SetTime(G4double t) {time = t;}
+  void SetEnergy(G4double e) {energy = e;}
+  void SetChannel(G4int c) {channel = c;}
+  void SetWeight(G4double w) {weight = w;}
+
+  const G4ThreeVector& GetPosition() const {return position;}
+  const G4ThreeVector& GetLocalPosition() const {return localPosition;}
+  G4double GetTime() const {return time;}
+  G4double GetEnergy() const {return energy;}
+  G4int GetChannel() const {return channel;}
+  G4double GetWeight() const {return weight;}
 
 private:
   G4int   photonCounts;
   //  G4double eDep;
   G4ThreeVector position;
+  G4ThreeVector localPosition;     // in the SiPM frame
+  G4double time;                   // global time
+  G4double energy;                 // photon energy
+  G4int    channel;                // copy number of the SiPM
+  G4double weight;                 // track weight, 1 unless played by a roulette
 };
 
 /// Define the "hit collection" using the template class G4THitsCollection:
@@ -44,18 +66,19 @@ typedef G4THitsCollection<SiPMHit> SiPMHitCollection;
 
 //  -- new and delete overloaded operators:
 
-extern G4Allocator<SiPMHit>   SiPMHitAllocator;
+extern G4ThreadLocal G4Allocator<SiPMHit>*   SiPMHitAllocator;
 
 inline void* SiPMHit::operator new(size_t)
 {
+  if (!SiPMHitAllocator) SiPMHitAllocator = new G4Allocator<SiPMHit>;
   void *aHit;
-  aHit = (void *) SiPMHitAllocator.MallocSingle();
+  aHit = (void *) SiPMHitAllocator->MallocSingle();
   return aHit;
 }
 
 inline void SiPMHit::operator delete(void *aHit)
 {
-  SiPMHitAllocator.FreeSingle((SiPMHit*) aHit);
+  SiPMHitAllocator->FreeSingle((SiPMHit*) aHit);
 }
 
 #endif
@@ -1,6 +1,11 @@
 /// This code was created based on B3a example
 /// Date created: May 27, 2020
 /// Authors: hexc. Zachary Langford and Nadia Qutob
+///
+/// October 19, 2026: The run action refreshes the stepping action dispatch lists.
+///                   Tracking action and spatial maps consumer.
+///                   Readout time gate and photon limiter consumers.
+///                   Optical step counter of the run telemetry.
 
 #include "FPActionInitialization.hh"
 #include "FPRunAction.hh"
@@ -8,6 +13,11 @@
 #include "FPSteppingAction.hh"
 #include "FPPrimaryGeneratorAction.hh"
 #include "FPStackingAction.hh"
+#include "FPTrackingAction.hh"
+#include "FPSpatialMaps.hh"
+#include "FPTimeGate.hh"
+#include "FPPhotonLimiter.hh"
+#include "FPTelemetry.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -40,7 +50,15 @@ void FPActionInitialization::Build() const
   SetUserAction(new FPPrimaryGeneratorAction);
   SetUserAction(new FPStackingAction);
 
-  SetUserAction(new FPSteppingAction(evtAction));  
+  SetUserAction(new FPTrackingAction);
+
+  FPSteppingAction* steppingAction = new FPSteppingAction(evtAction);
+  steppingAction->RegisterConsumer(runAction->GetSpatialMaps()->CreateStepConsumer());
+  steppingAction->RegisterConsumer(runAction->GetTimeGate()->CreateStepConsumer());
+  steppingAction->RegisterConsumer(runAction->GetPhotonLimiter()->CreateStepConsumer());
+  steppingAction->RegisterConsumer(FPTelemetry::Instance()->CreateStepConsumer());
+  runAction->SetSteppingAction(steppingAction);
+  SetUserAction(steppingAction);
 }  
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
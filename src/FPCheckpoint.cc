@@ -0,0 +1,398 @@
+/// October 19, 2026: Checkpoint and resume of long runs.
+///
+///    File layout (native byte order, written and read on the same cluster):
+///      base  : "FPCKBAS1", int32 generation, string master engine,
+///              uint32 number of shards, shards
+///      shard : "FPCKSHD1", int32 run ID, int32 generation, shard
+///    where a shard is
+///      uint32 n, FPEventRecord[n]
+///      uint32 m, m times (string name, string state)
+///      string engine state
+///    and a string is a uint32 length followed by its bytes.
+
+#include "FPCheckpoint.hh"
+#include "FPCheckpointMessenger.hh"
+
+#include "G4Threading.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+namespace {
+
+  const char baseMagic[8]  = { 'F','P','C','K','B','A','S','1' };
+  const char shardMagic[8] = { 'F','P','C','K','S','H','D','1' };
+
+  G4ThreadLocal std::chrono::steady_clock::time_point* lastShard = nullptr;
+
+  template <class T> void WriteValue(std::ostream& out, const T& value)
+  {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <class T> G4bool ReadValue(std::istream& in, T& value)
+  {
+    return (G4bool) in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  void WriteString(std::ostream& out, const std::string& s)
+  {
+    WriteValue(out, (uint32_t) s.size());
+    out.write(s.data(), s.size());
+  }
+
+  G4bool ReadString(std::istream& in, std::string& s)
+  {
+    uint32_t size;
+    if (!ReadValue(in, size)) return false;
+    s.resize(size);
+    return size == 0 || (G4bool) in.read(&s[0], size);
+  }
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCheckpoint* FPCheckpoint::Instance()
+{
+  // Created by the first run action (on the master) and kept for the whole job
+  static FPCheckpoint* instance = new FPCheckpoint();
+  return instance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCheckpoint::FPCheckpoint()
+  : fEnabled(false),
+    fDirectory("checkpoint"),
+    fInterval(600.),
+    fResume(false),
+    fRunID(0),
+    fGeneration(1),
+    fEngineRestored(true)
+{
+  fMessenger = new FPCheckpointMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCheckpoint::~FPCheckpoint()
+{
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4String FPCheckpoint::BaseFileName(const G4String& directory, G4int runID)
+{
+  std::ostringstream name;
+  name << directory << "/run" << runID << ".base";
+  return name.str();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4String FPCheckpoint::ShardPrefix(G4int runID, G4int generation)
+{
+  std::ostringstream name;
+  name << "run" << runID << ".g" << generation << ".";
+  return name.str();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+std::vector<G4String> FPCheckpoint::ListFiles(const G4String& directory, const G4String& prefix)
+{
+  std::vector<G4String> files;
+  DIR* dir = opendir(directory.c_str());
+  if (!dir) return files;
+  while (struct dirent* entry = readdir(dir)) {
+    G4String name = entry->d_name;
+    if (name.compare(0, prefix.size(), prefix) == 0
+	&& name.size() > 6 && name.substr(name.size() - 6) == ".shard") {
+      files.push_back(directory + "/" + name);
+    }
+  }
+  closedir(dir);
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+std::vector<G4int> FPCheckpoint::ListRuns(const G4String& directory)
+{
+  std::vector<G4int> runs;
+  DIR* dir = opendir(directory.c_str());
+  if (!dir) return runs;
+  while (struct dirent* entry = readdir(dir)) {
+    // run<ID>.base, as written by BaseFileName()
+    G4String name = entry->d_name;
+    if (name.size() <= 8 || name.compare(0, 3, "run") != 0
+	|| name.substr(name.size() - 5) != ".base") continue;
+    G4String id = name.substr(3, name.size() - 8);
+    if (id.find_first_not_of("0123456789") != G4String::npos) continue;
+    runs.push_back(std::atoi(id.c_str()));
+  }
+  closedir(dir);
+  std::sort(runs.begin(), runs.end());
+  return runs;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+std::string FPCheckpoint::SaveEngine()
+{
+  std::ostringstream out;
+  G4Random::getTheEngine()->put(out);
+  return out.str();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCheckpoint::RestoreEngine(const std::string& state)
+{
+  std::istringstream in(state);
+  G4Random::getTheEngine()->get(in);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCheckpoint::WriteShardData(std::ostream& out, const FPCheckpointShard& shard)
+{
+  WriteValue(out, (uint32_t) shard.records.size());
+  if (!shard.records.empty()) {
+    out.write(reinterpret_cast<const char*>(shard.records.data()),
+	      shard.records.size()*sizeof(FPEventRecord));
+  }
+  WriteValue(out, (uint32_t) shard.states.size());
+  for (const auto& state : shard.states) {
+    WriteString(out, state.first);
+    WriteString(out, state.second);
+  }
+  WriteString(out, shard.engineState);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPCheckpoint::ReadShardData(std::istream& in, FPCheckpointShard& shard)
+{
+  uint32_t nRecords, nStates;
+  if (!ReadValue(in, nRecords)) return false;
+  shard.records.resize(nRecords);
+  if (nRecords > 0
+      && !in.read(reinterpret_cast<char*>(shard.records.data()), nRecords*sizeof(FPEventRecord))) {
+    return false;
+  }
+  if (!ReadValue(in, nStates)) return false;
+  for (uint32_t i = 0; i < nStates; i++) {
+    std::string name, state;
+    if (!ReadString(in, name) || !ReadString(in, state)) return false;
+    shard.states[name] = state;
+  }
+  return ReadString(in, shard.engineState);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPCheckpoint::WriteAtomically(const G4String& fileName, const std::string& data)
+{
+  G4String tmpName = fileName + ".tmp";
+  {
+    std::ofstream out(tmpName, std::ios::binary | std::ios::trunc);
+    if (!out.write(data.data(), data.size()) || !out.flush()) return false;
+  }
+  return std::rename(tmpName.c_str(), fileName.c_str()) == 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPCheckpoint::Load(const G4String& directory, G4int runID, G4int& generation,
+			  std::string& masterEngine, std::vector<FPCheckpointShard>& shards)
+{
+  G4String baseName = BaseFileName(directory, runID);
+  std::ifstream in(baseName, std::ios::binary);
+  if (!in) return false;
+
+  char magic[8];
+  uint32_t nShards;
+  if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, baseMagic, sizeof(magic)) != 0
+      || !ReadValue(in, generation) || !ReadString(in, masterEngine) || !ReadValue(in, nShards)) {
+    G4ExceptionDescription msg;
+    msg << "Bad checkpoint file " << baseName;
+    G4Exception("FPCheckpoint::Load()", "FPCheckpoint001", FatalException, msg);
+    return false;
+  }
+  for (uint32_t i = 0; i < nShards; i++) {
+    shards.emplace_back();
+    if (!ReadShardData(in, shards.back())) {
+      G4ExceptionDescription msg;
+      msg << "Truncated checkpoint file " << baseName;
+      G4Exception("FPCheckpoint::Load()", "FPCheckpoint001", FatalException, msg);
+      return false;
+    }
+  }
+
+  // Add the shards of the workers of that generation
+  for (const auto& fileName : ListFiles(directory, ShardPrefix(runID, generation))) {
+    std::ifstream shardFile(fileName, std::ios::binary);
+    G4int shardRun, shardGeneration;
+    FPCheckpointShard shard;
+    if (shardFile.read(magic, sizeof(magic)) && std::memcmp(magic, shardMagic, sizeof(magic)) == 0
+	&& ReadValue(shardFile, shardRun) && ReadValue(shardFile, shardGeneration)
+	&& shardRun == runID && shardGeneration == generation && ReadShardData(shardFile, shard)) {
+      shards.push_back(shard);
+    } else {
+      G4ExceptionDescription msg;
+      msg << "Ignoring unreadable checkpoint shard " << fileName;
+      G4Exception("FPCheckpoint::Load()", "FPCheckpoint003", JustWarning, msg);
+    }
+  }
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCheckpoint::WriteBase(const std::string& masterEngine)
+{
+  std::ostringstream out;
+  out.write(baseMagic, sizeof(baseMagic));
+  WriteValue(out, fGeneration);
+  WriteString(out, masterEngine);
+  WriteValue(out, (uint32_t) fRestored.size());
+  for (const auto& shard : fRestored) WriteShardData(out, shard);
+
+  G4String baseName = BaseFileName(fDirectory, fRunID);
+  if (!WriteAtomically(baseName, out.str())) {
+    G4ExceptionDescription msg;
+    msg << "Can not write checkpoint file " << baseName;
+    G4Exception("FPCheckpoint::WriteBase()", "FPCheckpoint002", FatalException, msg);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCheckpoint::BeginOfRun(G4int runID)
+{
+  fRunID = runID;
+  fRestored.clear();
+  fCompleted.clear();
+  fSequentialEngine.clear();
+  fEngineRestored = true;
+  if (!fEnabled) return;
+
+  mkdir(fDirectory.c_str(), 0755);
+
+  G4int generation = 0;
+  std::string masterEngine;
+  if (fResume && Load(fDirectory, fRunID, generation, masterEngine, fRestored)) {
+    fGeneration = generation + 1;
+
+    // The next generation starts from a base holding everything done so far;
+    // once it is on disk the older shards are obsolete
+    WriteBase(masterEngine);
+    for (G4int g = 1; g <= generation; g++) {
+      for (const auto& fileName : ListFiles(fDirectory, ShardPrefix(fRunID, g))) {
+	std::remove(fileName.c_str());
+      }
+    }
+
+    RestoreEngine(masterEngine);
+
+    G4int lastEvent = -1;
+    for (const auto& shard : fRestored) {
+      for (const auto& record : shard.records) {
+	fCompleted.push_back(record.eventID);
+	if (record.eventID > lastEvent) {
+	  lastEvent = record.eventID;
+	  fSequentialEngine = shard.engineState;
+	}
+      }
+    }
+    std::sort(fCompleted.begin(), fCompleted.end());
+    fEngineRestored = G4Threading::IsMultithreadedApplication() || fSequentialEngine.empty();
+
+    G4cout << "Resuming run " << fRunID << " from " << BaseFileName(fDirectory, fRunID) << ": "
+	   << fCompleted.size() << " events already done" << G4endl;
+  } else {
+    // Fresh start: forget any earlier checkpoint of this run
+    for (const auto& fileName : ListFiles(fDirectory, "run" + std::to_string(fRunID) + ".g")) {
+      std::remove(fileName.c_str());
+    }
+    fGeneration = 1;
+    WriteBase(SaveEngine());
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPCheckpoint::IsCompleted(G4int eventID) const
+{
+  return !fCompleted.empty() && std::binary_search(fCompleted.begin(), fCompleted.end(), eventID);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPCheckpoint::SkipEvent(G4int eventID)
+{
+  if (fCompleted.empty()) return false;
+  if (IsCompleted(eventID)) return true;
+
+  // Sequential mode: continue the random sequence where the checkpoint left it
+  if (!fEngineRestored) {
+    RestoreEngine(fSequentialEngine);
+    fEngineRestored = true;
+  }
+  return false;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCheckpoint::BeginOfThreadRun()
+{
+  if (!lastShard) lastShard = new std::chrono::steady_clock::time_point();
+  *lastShard = std::chrono::steady_clock::now();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPCheckpoint::IsDue() const
+{
+  auto now = std::chrono::steady_clock::now();
+  if (!lastShard) lastShard = new std::chrono::steady_clock::time_point(now);
+  return std::chrono::duration<G4double>(now - *lastShard).count() >= fInterval;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCheckpoint::WriteShard(const FPCheckpointShard& shard)
+{
+  std::ostringstream out;
+  out.write(shardMagic, sizeof(shardMagic));
+  WriteValue(out, fRunID);
+  WriteValue(out, fGeneration);
+  WriteShardData(out, shard);
+
+  std::ostringstream name;
+  name << fDirectory << "/" << ShardPrefix(fRunID, fGeneration) << "t"
+       << std::max(G4Threading::G4GetThreadId(), 0) << ".shard";
+  if (!WriteAtomically(name.str(), out.str())) {
+    G4ExceptionDescription msg;
+    msg << "Can not write checkpoint shard " << name.str();
+    G4Exception("FPCheckpoint::WriteShard()", "FPCheckpoint004", JustWarning, msg);
+  }
+
+  if (!lastShard) lastShard = new std::chrono::steady_clock::time_point();
+  *lastShard = std::chrono::steady_clock::now();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,93 @@
+/// October 19, 2026: Checkpoint messenger.
+///
+///    /FP/checkpoint/enable    : write checkpoints during the runs
+///    /FP/checkpoint/directory : directory of the checkpoint files
+///    /FP/checkpoint/interval  : wall-clock time between two checkpoints of a worker
+///    /FP/checkpoint/resume    : continue the runs from the checkpoint on disk
+///
+///    The checkpoint is shared by all threads: the commands are not broadcast.
+
+#include "globals.hh"
+
+#include "FPCheckpointMessenger.hh"
+
+#include "FPCheckpoint.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4SystemOfUnits.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCheckpointMessenger::FPCheckpointMessenger(FPCheckpoint* FPCheck)
+:FPCkpt(FPCheck)
+{
+  checkpointDir = new G4UIdirectory("/FP/checkpoint/");
+  checkpointDir->SetGuidance("Checkpoint and resume of long runs:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/checkpoint/enable", this);
+  SetEnableCmd->SetGuidance("Write checkpoints (random engine, completed events, accumulables)");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetEnableCmd->SetToBeBroadcasted(false);
+
+  SetDirectoryCmd = new G4UIcmdWithAString("/FP/checkpoint/directory", this);
+  SetDirectoryCmd->SetGuidance("Directory of the checkpoint files");
+  SetDirectoryCmd->SetParameterName("directory", false);
+  SetDirectoryCmd->SetDefaultValue("checkpoint");
+  SetDirectoryCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetDirectoryCmd->SetToBeBroadcasted(false);
+
+  SetIntervalCmd = new G4UIcmdWithADoubleAndUnit("/FP/checkpoint/interval", this);
+  SetIntervalCmd->SetGuidance("Wall-clock time between two checkpoints of a worker");
+  SetIntervalCmd->SetParameterName("interval", false);
+  SetIntervalCmd->SetRange("interval >= 0.");
+  SetIntervalCmd->SetUnitCategory("Time");
+  SetIntervalCmd->SetDefaultUnit("s");
+  SetIntervalCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetIntervalCmd->SetToBeBroadcasted(false);
+
+  SetResumeCmd = new G4UIcmdWithABool("/FP/checkpoint/resume", this);
+  SetResumeCmd->SetGuidance("Continue each run from its checkpoint, if there is one;");
+  SetResumeCmd->SetGuidance("use the same macro (and /run/beamOn) as the interrupted job.");
+  SetResumeCmd->SetParameterName("resume", true);
+  SetResumeCmd->SetDefaultValue(true);
+  SetResumeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetResumeCmd->SetToBeBroadcasted(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCheckpointMessenger::~FPCheckpointMessenger()
+{
+  delete SetEnableCmd;
+  delete SetDirectoryCmd;
+  delete SetIntervalCmd;
+  delete SetResumeCmd;
+  delete checkpointDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCheckpointMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPCkpt->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetDirectoryCmd ) {
+      FPCkpt->SetDirectory(newValues);
+    }
+
+    if (command == SetIntervalCmd ) {
+      FPCkpt->SetInterval(SetIntervalCmd->GetNewDoubleValue(newValues)/s);
+    }
+
+    if (command == SetResumeCmd ) {
+      FPCkpt->SetResume(SetResumeCmd->GetNewBoolValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,196 @@
+/// October 19, 2026: Coincidence trigger of the panel stack.
+
+#include "FPCoincidenceTrigger.hh"
+#include "FPCoincidenceTriggerMessenger.hh"
+#include "FPDetectorConstruction.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4RunManager.hh"
+
+#include <algorithm>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+
+G4ThreadLocal FPCoincidenceTrigger* FPCoincidenceTrigger::fgInstance = nullptr;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCoincidenceTrigger::FPCoincidenceTrigger()
+  : G4VAccumulable("CoincidenceTrigger"),
+    fEnabled(false),
+    fFold(0),
+    fMinPhotons(1),
+    fNPanels(1),
+    fRequired(1),
+    fTrackedPanel(kCharged),
+    fNFired(0),
+    fCutShort(false)
+{
+  Reset();
+  fgInstance = this;
+  fMessenger = new FPCoincidenceTriggerMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCoincidenceTrigger::~FPCoincidenceTrigger()
+{
+  if (fgInstance == this) fgInstance = nullptr;
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::Merge(const G4VAccumulable& other)
+{
+  const FPCoincidenceTrigger& trigger = static_cast<const FPCoincidenceTrigger&>(other);
+  fNEvents        += trigger.fNEvents;
+  fNTriggered     += trigger.fNTriggered;
+  fNDecidedEarly  += trigger.fNDecidedEarly;
+  fNKilledPhotons += trigger.fNKilledPhotons;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::Reset()
+{
+  fNEvents = 0;
+  fNTriggered = 0;
+  fNDecidedEarly = 0;
+  fNKilledPhotons = 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::BeginOfRun()
+{
+  // Workers share the detector construction of the master
+  auto detector = dynamic_cast<const FPDetectorConstruction*>(
+    G4RunManager::GetRunManager()->GetUserDetectorConstruction());
+  fNPanels = detector ? detector->GetNumberOfPanels() : 1;
+  fRequired = (fFold > 0) ? std::min(fFold, fNPanels) : fNPanels;
+
+  fPanelPhotons.assign(fNPanels, 0);
+  fPanelHits.assign(fNPanels, 0);
+  fPanelTracked.assign(fNPanels, false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::BeginOfEvent()
+{
+  fTrackedPanel = kCharged;
+  fNFired = 0;
+  fCutShort = false;
+  std::fill(fPanelPhotons.begin(), fPanelPhotons.end(), 0);
+  std::fill(fPanelTracked.begin(), fPanelTracked.end(), false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::CountFiredPanels(const SiPMHitCollection* hits)
+{
+  std::fill(fPanelHits.begin(), fPanelHits.end(), 0);
+  std::size_t nHits = hits ? hits->entries() : 0;
+  for (std::size_t i = 0; i < nHits; i++) {
+    G4int channel = (*hits)[i]->GetChannel();
+    if (channel >= 0 && channel < fNPanels) fPanelHits[channel]++;
+  }
+
+  fNFired = 0;
+  for (G4int panel = 0; panel < fNPanels; panel++) {
+    if (fPanelHits[panel] >= fMinPhotons) fNFired++;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPCoincidenceTrigger::NextPanel(const SiPMHitCollection* hits)
+{
+  if (fTrackedPanel == kAllPanels || fTrackedPanel == kNoPanel) return fTrackedPanel;
+
+  CountFiredPanels(hits);
+  if (fNFired >= fRequired) return fTrackedPanel = kAllPanels;
+
+  // Panels that may still fire; track the one with the fewest photons first,
+  // as the most likely to fix the outcome at the lowest cost
+  G4int nPending = 0;
+  G4int next = kNoPanel;
+  for (G4int panel = 0; panel < fNPanels; panel++) {
+    if (fPanelTracked[panel] || fPanelHits[panel] >= fMinPhotons) continue;
+    if (fPanelHits[panel] + fPanelPhotons[panel] < fMinPhotons) continue;
+    nPending++;
+    if (next == kNoPanel || fPanelPhotons[panel] < fPanelPhotons[next]) next = panel;
+  }
+  if (fNFired + nPending < fRequired) return fTrackedPanel = kNoPanel;
+
+  fPanelTracked[next] = true;
+  return fTrackedPanel = next;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPCoincidenceTrigger::EndOfEvent(const SiPMHitCollection* hits)
+{
+  CountFiredPanels(hits);
+  G4bool triggered = (fNFired >= fRequired);
+
+  fNEvents++;
+  if (triggered) fNTriggered++;
+  return triggered;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::Print() const
+{
+  if (!fEnabled || fNEvents == 0) return;
+
+  FPPrecisionGuard precisionGuard;
+  G4cout << G4endl << " Coincidence trigger (" << fRequired << " of " << fNPanels
+	 << " panels, " << fMinPhotons << " photon(s) each):" << G4endl
+	 << std::setprecision(4)
+	 << "   triggered   : " << fNTriggered << " of " << fNEvents << " events ("
+	 << 100.*fNTriggered/fNEvents << " %)" << G4endl
+	 << "   decided early: " << fNDecidedEarly << " events rejected, " << fNKilledPhotons
+	 << " optical photons not tracked (left out of the light yield)" << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::Save(std::ostream& out) const
+{
+  G4long counts[6] = { fNPanels, fRequired, fNEvents, fNTriggered, fNDecidedEarly, fNKilledPhotons };
+  out.write(reinterpret_cast<const char*>(counts), sizeof(counts));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTrigger::Restore(std::istream& in)
+{
+  G4long counts[6];
+  if (!in.read(reinterpret_cast<char*>(counts), sizeof(counts))) return;
+
+  // A trigger sized for the current stack (BeginOfRun), or already holding
+  // counts, only takes the counts of the same stack; an empty one (fpMerge)
+  // takes the configuration of the first checkpoint for its report
+  G4bool configured = !fPanelHits.empty() || fNEvents > 0;
+  if (configured && (counts[0] != fNPanels || counts[1] != fRequired)) {
+    G4ExceptionDescription msg;
+    msg << "Checkpoint of a " << counts[1] << " of " << counts[0] << " panel trigger, "
+	<< fRequired << " of " << fNPanels << " configured: trigger counts not restored";
+    G4Exception("FPCoincidenceTrigger::Restore()", "FPTrigger001", JustWarning, msg);
+    return;
+  }
+  if (!configured) {
+    fNPanels  = counts[0];
+    fRequired = counts[1];
+  }
+  fNEvents        += counts[2];
+  fNTriggered     += counts[3];
+  fNDecidedEarly  += counts[4];
+  fNKilledPhotons += counts[5];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,72 @@
+/// October 19, 2026: Coincidence trigger messenger.
+///
+///    /FP/trigger/enable     : N-fold coincidence of the panels; stop tracking photons once decided
+///    /FP/trigger/fold       : number of panels required (0: all)
+///    /FP/trigger/minPhotons : photons on the SiPM for a panel to fire
+
+#include "globals.hh"
+
+#include "FPCoincidenceTriggerMessenger.hh"
+
+#include "FPCoincidenceTrigger.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAnInteger.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCoincidenceTriggerMessenger::FPCoincidenceTriggerMessenger(FPCoincidenceTrigger* FPTrig)
+:FPTrigger(FPTrig)
+{
+  triggerDir = new G4UIdirectory("/FP/trigger/");
+  triggerDir->SetGuidance("Coincidence trigger of the panel stack:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/trigger/enable", this);
+  SetEnableCmd->SetGuidance("Require a coincidence of the panels; the optical photons are tracked");
+  SetEnableCmd->SetGuidance("panel by panel and those left are killed once the trigger has failed.");
+  SetEnableCmd->SetGuidance("Only triggered events are digitized and streamed.");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetFoldCmd = new G4UIcmdWithAnInteger("/FP/trigger/fold", this);
+  SetFoldCmd->SetGuidance("Number of panels required (0: all the panels)");
+  SetFoldCmd->SetParameterName("n", false);
+  SetFoldCmd->SetRange("n >= 0");
+  SetFoldCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetMinPhotonsCmd = new G4UIcmdWithAnInteger("/FP/trigger/minPhotons", this);
+  SetMinPhotonsCmd->SetGuidance("Photons on the SiPM for a panel to fire");
+  SetMinPhotonsCmd->SetParameterName("n", false);
+  SetMinPhotonsCmd->SetRange("n > 0");
+  SetMinPhotonsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPCoincidenceTriggerMessenger::~FPCoincidenceTriggerMessenger()
+{
+  delete SetEnableCmd;
+  delete SetFoldCmd;
+  delete SetMinPhotonsCmd;
+  delete triggerDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPCoincidenceTriggerMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPTrigger->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetFoldCmd ) {
+      FPTrigger->SetFold(SetFoldCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetMinPhotonsCmd ) {
+      FPTrigger->SetMinPhotons(SetMinPhotonsCmd->GetNewIntValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -31,6 +31,31 @@
 //
 // February 12, 2025L Hexc, Munir, Shahid, Jerad, Elsayed
 //                        Fixed the problem of positioning the opening hole for the SiPM readout.
+//
+// October 19, 2026: The cladding (and the fiber core inside it) is the envelope of an optional
+//                        fast simulation model for the photons re-emitted and trapped in the fiber.
+//
+// October 19, 2026: The optical properties of the materials and of the wrapping surface are read
+//                        from opticalProperties.txt (see FPOpticalPropertyDB) instead of being hard-coded.
+//
+// October 19, 2026: Stack of N panels for muon tracking. The wrapping, the panel (with the
+//                        epoxy, cladding and fiber) and the SiPM are placed in a module volume,
+//                        which is placed once per panel with the panel number as copy number.
+//                        Panels with the same fiber offset share the same logical module, and the
+//                        fiber itself is shared by all of them. runConfig.txt is read in the
+//                        constructor, its fiber position being the default of every panel.
+//
+// October 19, 2026: The scintillation yields of the property file are scaled by the factor of
+//                        /FP/optical/yieldFactor (see FPOpticalControl).
+//
+// October 19, 2026: The geometry may be rebuilt between runs (panel thickness, spacing and fiber
+//                        offsets): the fiber region, its fast model and the SiPM sensitive detector
+//                        are kept and attached to the new volumes.
+//                        The SiPM and its hole are placed at the depth of the fiber (0.445*panelZ
+//                        for the 1 cm panel) whatever the panel thickness.
+//
+// October 19, 2026: The property database is handed to FPOpticalControl, for the optical
+//                        property scans between runs (/FP/optical/setProperty).
 
 #include "FPDetectorConstruction.hh"
 
@@ -56,8 +81,16 @@
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "FPSiPMSD.hh"                           // added July 22, 2020
+#include "FPDetectorMessenger.hh"
+#include "FPFiberFastModel.hh"
+#include "FPOpticalPropertyDB.hh"
+#include "FPOpticalControl.hh"
+#include "G4Region.hh"
+#include "G4UImanager.hh"
 
 #include <math.h>
+#include <fstream>
+#include <sstream>
 
 using namespace std;
 
@@ -65,8 +98,21 @@ using namespace std;
 
 FPDetectorConstruction::FPDetectorConstruction()
 : G4VUserDetectorConstruction(),
-  fCheckOverlaps(true)
+  sipmLV(nullptr),
+  fiberLV(nullptr),
+  claddingLV(nullptr),
+  fiberRegion(nullptr),
+  fNPanels(1),
+  fPanelSpacing(10.0*cm),
+  fFiberOffset(0.0),
+  fGeometryModified(false),
+  fCheckOverlaps(true),
+  fFiberFastModel(false),
+  opticalPropertyFile("opticalProperties.txt"),
+  opticalProperties(nullptr)
 {
+  detectorMessenger = new FPDetectorMessenger(this);
+
   DefineMaterials();
   
   // Define the dimensions of all components 
@@ -84,13 +130,39 @@ FPDetectorConstruction::FPDetectorConstruction()
 
   epoxyL = panelXY - 0.005*mm;
   epoxyD = 1.1*claddingD;
- 
+
+  // read the data through configuration file
+  std::ifstream infile ("runConfig.txt");
+  
+  std::string line;
+  
+  // Skip two comment lines
+  std::getline(infile, line);
+  G4cout << line << G4endl;
+
+  while (std::getline(infile, line))
+  {
+    vector<string> row_values;
+
+    split(line, ',', row_values);
+
+    fFiberOffset = stod(row_values[0])*cm;
+    //    blockX = stod(row_values[1])*cm;
+    //    blockY = stod(row_values[2])*cm;
+    //    blockZ = stod(row_values[3])*cm;   
+  }
+
+  infile.close();
+  // end of reading the config file
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 FPDetectorConstruction::~FPDetectorConstruction()
-{ }
+{
+  delete detectorMessenger;
+  delete opticalProperties;
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -135,33 +207,8 @@ void FPDetectorConstruction::DefineMaterials()
 
 G4VPhysicalVolume* FPDetectorConstruction::Construct()
 {
+  fGeometryModified = false;
 
-  // read the data through configuration file
-  std::ifstream infile ("runConfig.txt");
-  
-  std::string line;
-  
-  // Skip two comment lines
-  std::getline(infile, line);
-  G4cout << line << G4endl;
-
-  G4double Epoxy_ypos = 0.0;
-  
-  while (std::getline(infile, line))
-  {
-    vector<string> row_values;
-
-    split(line, ',', row_values);
-
-    Epoxy_ypos = stod(row_values[0])*cm;
-    //    blockX = stod(row_values[1])*cm;
-    //    blockY = stod(row_values[2])*cm;
-    //    blockZ = stod(row_values[3])*cm;   
-  }
-
-  infile.close();
-  // end of reading the config file
-  
   // Gamma detector Parameters
   //
   G4double cryst_dX = 6*cm, cryst_dY = 6*cm, cryst_dZ = 3*cm;
@@ -185,11 +232,26 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
   epoxy_mat   = nist->FindOrBuildMaterial("EJ500");
   wrapping_mat = nist->FindOrBuildMaterial("G4_Al");
   
+  //
+  // Wrapping material (Al foil) thickness, around each panel
+  //
+  G4double padding_1 = 0.1*mm;   // changed from 0.001*mm to 0.1*mm
+  G4double padding_2 = 0.2*mm;   // changed from 0.001*mm to 0.1*mm
+
+  // Panel stack: the wrapped panels must not overlap
+  G4double moduleZ = panelZ + 2*padding_2;
+  if (fNPanels < 1 || (fNPanels > 1 && fPanelSpacing < moduleZ)) {
+    G4ExceptionDescription msg;
+    msg << fNPanels << " panels with a spacing of " << fPanelSpacing/cm
+	<< " cm: at least one panel, spaced by at least " << moduleZ/cm << " cm";
+    G4Exception("FPDetectorConstruction::Construct()", "FPDet001", FatalException, msg);
+  }
+
   //     
   // World
   //
   G4double world_sizeXY = 30*cm;
-  G4double world_sizeZ  = 5.0*cm;     
+  G4double world_sizeZ  = 5.0*cm + 2*(fNPanels-1)*fPanelSpacing;     // panel 0 at the center
   
   G4Box* solidWorld =    
     new G4Box("World",                                                                    //its name
@@ -210,6 +272,13 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
                       0,                                      //copy number
                       fCheckOverlaps);             // checking overlaps 
                  
+  //
+  // Module: envelope of a wrapped panel and its SiPM
+  //
+  G4Box* solidModule =
+    new G4Box("Module",
+	      0.5*panelXY+padding_2, 0.5*panelXY+padding_2, 0.5*moduleZ);
+
   //
   // Scintillator Panel
   //
@@ -217,28 +286,6 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
     new G4Box("Panel",
 	      0.5*panelXY, 0.5*panelXY, 0.5*panelZ);
   
-  G4LogicalVolume* PanelLV =                         
-    new G4LogicalVolume(solidPanel, 
-                        panel_mat ,
-                        "PanelLV");
-  //
-  // Place the panel in the world volume
-  //
-  G4PVPlacement* PanelPV = new G4PVPlacement(0,                 //no rotation
-					     G4ThreeVector(),         //at (0,0,0)
-					     PanelLV,                   //its logical volume
-					     "PanelPV",                    //its name
-					     WorldLV,                   //its mother  volume
-					     false,                            //no boolean operation
-					     0,                                  //copy number
-					     fCheckOverlaps);         // checking overlaps
- 
-  //
-  // Wrapping material (Al foil)
-  //
-  G4double padding_1 = 0.1*mm;   // changed from 0.001*mm to 0.1*mm
-  G4double padding_2 = 0.2*mm;   // changed from 0.001*mm to 0.1*mm
-
   // Smaller box for making the wrapping material
   G4Box* solidWrappingBox_1 =    
     new G4Box("WrappingBox1",                                                                                             //its name
@@ -268,15 +315,6 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
   sipmLV = new G4LogicalVolume(solidSensor,
 			       default_mat,
 			       "sipmLV");
-  // Positioning the SiPM to the end of the fiber, using Epoxy_ypos parameter
-  G4PVPlacement* sipmPV = new G4PVPlacement(0,                 //no rotation
-					    G4ThreeVector( (0.5*panelXY+padding_1+0.5*(padding_2-padding_1)), Epoxy_ypos, 0.445*panelZ ),         //at (0,0,0)
-					     sipmLV,                        //its logical volume
-					     "sipmPV",                     //its name
-					     WorldLV,                      //its mother  volume
-					     false,                            //no boolean operation
-					     0,                                  //copy number
-					     fCheckOverlaps);         // checking overlaps
 
   // SiPM sensor visualization attribute
   G4VisAttributes photonDetectorVisAtt(G4Colour::Red());
@@ -291,26 +329,6 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
   
   G4Box* solidSensorHole = new G4Box("Hole", Hole_x/2, Hole_y/2, Hole_z/2);
   
-  // Rotate along y-axis (defined earlier for making the groove
-  //  yRot->rotateY(90*deg);                                          // rotate 90 degree along Y-axis  
-  G4ThreeVector holeTrans( (0.5*panelXY+padding_1+0.5*(padding_2-padding_1)), Epoxy_ypos, 0.445*panelZ);  
-
-  G4SubtractionSolid* solidWrappingHole =
-    new G4SubtractionSolid("WrappingHole", solidWrapping, solidSensorHole, 0, holeTrans);
-
-  G4LogicalVolume* WrappingLV =
-    new G4LogicalVolume(solidWrappingHole,
-			wrapping_mat,
-			"WrappingLV");
-
-  G4PVPlacement* WrappingPV = new G4PVPlacement(0,                 //no rotation
-					     G4ThreeVector(),         //at (0,0,0)
-					     WrappingLV,                //its logical volume
-					     "WrappingPV",             //its name
-					     WorldLV,                      //its mother  volume
-					     false,                            //no boolean operation
-					     0,                                  //copy number
-					     fCheckOverlaps);         // checking overlaps
   //     
   // Optical epoxy
   //
@@ -325,15 +343,6 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
   G4RotationMatrix* yRot = new G4RotationMatrix; 
   yRot->rotateY(90*deg);                                          // rotate 90 degree along Y-axis  
 
-  // Put epoxy inside the Panel
-  G4PVPlacement* EpoxyPV = new G4PVPlacement(yRot,                                        // no rotation
-					     G4ThreeVector(0.0, Epoxy_ypos, 0.5*(panelZ - epoxyD)),         // Near the surface of the panel
-					     EpoxyLV,                                                                         //its logical volume
-					     "EpoxyPV",                                                                      //its name
-					     PanelLV,                           // its mother  volume
-					     false,                                // no boolean operation
-					     0,                                      // copy number
-					    fCheckOverlaps);             // checking overlaps 
   //     
   // Y-11 cladding
   //
@@ -376,6 +385,88 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
 					     false, 
 					     0,
 					     fCheckOverlaps);
+
+  //
+  // Build one module per distinct fiber offset and place it for each panel.
+  // The module copy number is the panel number, read back as the SiPM channel.
+  //
+  std::map<G4double, G4LogicalVolume*> modules;
+  std::vector<G4LogicalVolume*> wrappingLVs;
+  for (G4int panel = 0; panel < fNPanels; panel++) {
+    G4double Epoxy_ypos = GetFiberOffset(panel);
+    G4LogicalVolume*& ModuleLV = modules[Epoxy_ypos];
+    if (!ModuleLV) {
+      ModuleLV = new G4LogicalVolume(solidModule, default_mat, "ModuleLV");
+      ModuleLV->SetVisAttributes(G4VisAttributes::GetInvisible());
+
+      G4LogicalVolume* PanelLV =                         
+	new G4LogicalVolume(solidPanel, 
+			    panel_mat ,
+			    "PanelLV");
+      //
+      // Place the panel in the module
+      //
+      new G4PVPlacement(0,                 //no rotation
+			G4ThreeVector(),         //at (0,0,0)
+			PanelLV,                   //its logical volume
+			"PanelPV",                    //its name
+			ModuleLV,                   //its mother  volume
+			false,                            //no boolean operation
+			0,                                  //copy number
+			fCheckOverlaps);         // checking overlaps
+
+      // Positioning the SiPM to the end of the fiber, using Epoxy_ypos parameter
+      new G4PVPlacement(0,                 //no rotation
+			G4ThreeVector( (0.5*panelXY+padding_1+0.5*(padding_2-padding_1)), Epoxy_ypos, 0.5*(panelZ - epoxyD) ),
+			sipmLV,                        //its logical volume
+			"sipmPV",                     //its name
+			ModuleLV,                      //its mother  volume
+			false,                            //no boolean operation
+			0,                                  //copy number
+			fCheckOverlaps);         // checking overlaps
+
+      // Rotate along y-axis (defined earlier for making the groove
+      //  yRot->rotateY(90*deg);                                          // rotate 90 degree along Y-axis  
+      G4ThreeVector holeTrans( (0.5*panelXY+padding_1+0.5*(padding_2-padding_1)), Epoxy_ypos, 0.5*(panelZ - epoxyD));  
+
+      G4SubtractionSolid* solidWrappingHole =
+	new G4SubtractionSolid("WrappingHole", solidWrapping, solidSensorHole, 0, holeTrans);
+
+      G4LogicalVolume* WrappingLV =
+	new G4LogicalVolume(solidWrappingHole,
+			    wrapping_mat,
+			    "WrappingLV");
+      wrappingLVs.push_back(WrappingLV);
+
+      new G4PVPlacement(0,                 //no rotation
+			G4ThreeVector(),         //at (0,0,0)
+			WrappingLV,                //its logical volume
+			"WrappingPV",             //its name
+			ModuleLV,                      //its mother  volume
+			false,                            //no boolean operation
+			0,                                  //copy number
+			fCheckOverlaps);         // checking overlaps
+
+      // Put epoxy inside the Panel
+      new G4PVPlacement(yRot,                                        // no rotation
+			G4ThreeVector(0.0, Epoxy_ypos, 0.5*(panelZ - epoxyD)),         // Near the surface of the panel
+			EpoxyLV,                                                                         //its logical volume
+			"EpoxyPV",                                                                      //its name
+			PanelLV,                           // its mother  volume
+			false,                                // no boolean operation
+			0,                                      // copy number
+			fCheckOverlaps);             // checking overlaps 
+    }
+
+    new G4PVPlacement(0,
+		      G4ThreeVector(0.0, 0.0, -panel*fPanelSpacing),
+		      ModuleLV,
+		      "ModulePV",
+		      WorldLV,
+		      false,
+		      panel,                                  // copy number: panel / SiPM channel
+		      fCheckOverlaps);
+  }
   
   // Visualization attributes
   //
@@ -390,211 +481,26 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
   
   CladdingLV->SetVisAttributes(cladding);  
 
-  //
-  // Define optical material properties for panel
-  //
-  // We use EJ-200 plastic scintillator for this study. The optical properties can be found from the link below:
-  // https://eljentechnology.com/products/plastic-scintillators/ej-200-ej-204-ej-208-ej-212
-  //
-
-  //  G4double photonEnergy[] =
-  std::vector<G4double> photonEnergy=
-  {2.00*eV,2.03*eV,2.06*eV,2.09*eV,2.12*eV,
-   2.15*eV,2.18*eV,2.21*eV,2.24*eV,2.27*eV,
-   2.30*eV,2.33*eV,2.36*eV,2.39*eV,2.42*eV,
-   2.45*eV,2.48*eV,2.51*eV,2.54*eV,2.57*eV,
-   2.60*eV,2.63*eV,2.66*eV,2.69*eV,2.72*eV,
-   2.75*eV,2.78*eV,2.81*eV,2.84*eV,2.87*eV,
-   2.90*eV,2.93*eV,2.96*eV,2.99*eV,3.02*eV,
-   3.05*eV,3.08*eV,3.11*eV,3.14*eV,3.17*eV,
-   3.20*eV,3.23*eV,3.26*eV,3.29*eV,3.32*eV,
-   3.35*eV,3.38*eV,3.41*eV,3.44*eV,3.47*eV};
-
-  const G4int nEntries = sizeof(photonEnergy)/sizeof(G4double);
-  
-  std::vector<G4double> RefractiveIndex_Panel =                                              // from EJEN website
-    {1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58,
-     1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58,
-     1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58,
-     1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58,
-     1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58, 1.58};
-  
-  assert(sizeof(RefractiveIndex_Panel) == sizeof(photonEnergy));
-  
-  std::vector<G4double> Absorption_Panel =                                                      // from EJEN website
-    {3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m,
-     3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m,
-     3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m,
-     3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m,
-     3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m, 3.8*m
-    };
-  
-  assert(sizeof(Absorption_Panel) == sizeof(photonEnergy));
-
-  // Adjusted for scintillator panel
-  std::vector<G4double> PanelReflect =
-    {0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95,
-     0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95,
-     0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95,
-     0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95,
-     0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95, 0.95
-    };
-
-  assert(sizeof(PanelReflect) == sizeof(photonEnergy));
-
-  // Not sure about these parameters yet!!!  6/22/2020
-  //  G4double SpecularLobe[NUM]    = {0.3, 0.3};
-  //  G4double SpecularSpike[NUM]   = {0.2, 0.2};
-  //  G4double Backscatter[NUM]     = {0.2, 0.2};       // need to check these values
-  
-  G4MaterialPropertiesTable *Panel = new G4MaterialPropertiesTable();
-  //  Panel->AddProperty("RINDEX", photonEnergy, RefractiveIndex_Panel, nEntries);
-  //  Panel->AddProperty("REFLECTIVITY", photonEnergy, PanelReflect, nEntries);
-  //  Panel->AddProperty("ABSLENGTH", photonEnergy, Absorption_Panel, nEntries);
-  Panel->AddProperty("RINDEX", photonEnergy, RefractiveIndex_Panel);
-  Panel->AddProperty("REFLECTIVITY", photonEnergy, PanelReflect);
-  Panel->AddProperty("ABSLENGTH", photonEnergy, Absorption_Panel);  
-  
-  // For EJ-200 scintillator
-  //G4double ScintEnergy[] = {2.48*eV, 3.1*eV};
-  //G4double ScintFast[] = {1.0, 1.1};
-  //const G4int nScintEntries = sizeof(ScintEnergy)/sizeof(G4double);
-  //  Panel->AddProperty("FASTCOMPONENT", ScintEnergy, ScintFast, nScintEntries);
-  std::vector<G4double> ScintFast =
-    {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
-  
-  Panel->AddProperty("SCINTILLATIONCOMPONENT1", photonEnergy, ScintFast);
-  
-  Panel->AddConstProperty("SCINTILLATIONYIELD", 10000/MeV);
-  Panel->AddConstProperty("RESOLUTIONSCALE", 1.);
-  //  Panel->AddConstProperty("FASTTIMECONSTANT", 1.*ns);
-  Panel->AddConstProperty("SCINTILLATIONTIMECONSTANT1", 1.*ns);
-  Panel->AddConstProperty("SCINTILLATIONYIELD1", 1.);
-  
-  // set in the panel material property
-  panel_mat->SetMaterialPropertiesTable(Panel);
-
-  //
-  // Define optical material properties for air
-  //
-  std::vector<G4double> RefractiveIndex_Air =
-    {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
-     1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
-  
-  assert(sizeof(RefractiveIndex_Air) == sizeof(photonEnergy));
-  
-  std::vector<G4double> Absorption_Air =
-    {10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m,
-     10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m,
-     10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m,
-     10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m,
-     10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m, 10.0*m
-    };    // A guessed number
-
-  assert(sizeof(Absorption_Air) == sizeof(photonEnergy));
-
-  // Need to check this parameter for air  6/22/2020
-  std::vector<G4double> AirReflect      =
-    {0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98,
-     0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98,
-     0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98,
-     0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98,
-     0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98, 0.98
-    }; 
-  
-  assert(sizeof(AirReflect) == sizeof(photonEnergy));
-  
-  G4MaterialPropertiesTable *Air = new G4MaterialPropertiesTable();
-  Air->AddProperty("RINDEX", photonEnergy, RefractiveIndex_Air);
-  // Note 100% sure if one needs to define the following two properties or not.
-  //  Air->AddProperty("REFLECTIVITY", photonEnergy, AirReflect, nEntries);
-  //  Air->AddProperty("ABSLENGTH", photonEnergy, Absorption_Air, nEntries);
-
-  default_mat->SetMaterialPropertiesTable(Air);  
-  
-  // For Expoxy (EJ-500)
-  std::vector<G4double> refractiveIndexEpoxy =
-  { 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57,
-    1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57,
-    1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57,
-    1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57,
-    1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57, 1.57};
-
-  assert(sizeof(refractiveIndexEpoxy) == sizeof(photonEnergy));
-
-  G4MaterialPropertiesTable *Epoxy = new G4MaterialPropertiesTable();
-  Epoxy->AddProperty("RINDEX", photonEnergy, refractiveIndexEpoxy);
-  Epoxy->AddProperty("REFLECTIVITY", photonEnergy, PanelReflect);    // same as for panel. May not need!
-  Epoxy->AddProperty("ABSLENGTH", photonEnergy, Absorption_Panel);     // same as for panel  for now !
-
-  epoxy_mat->SetMaterialPropertiesTable(Epoxy);
-  
-  // For Y11-Cladding
-  std::vector<G4double> refractiveIndexCladding =
-  { 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49,
-    1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49,
-    1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49,
-    1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49,
-    1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49, 1.49};
+  fiberLV = FiberLV;
+  claddingLV = CladdingLV;
 
-  assert(sizeof(refractiveIndexCladding) == sizeof(photonEnergy));
-
-  G4MaterialPropertiesTable *Cladding = new G4MaterialPropertiesTable();
-  Cladding->AddProperty("RINDEX", photonEnergy, refractiveIndexCladding);
-  Cladding->AddProperty("REFLECTIVITY", photonEnergy, PanelReflect);          // same as for panel. May not need!
-  Cladding->AddProperty("ABSLENGTH", photonEnergy, Absorption_Panel);     // same as panel  for now !
-
-  cladding_mat->SetMaterialPropertiesTable(Cladding);
-
-  //
-  // Define optical material properties for the fiber
-  /* Copied from WLS example  6/19/2020  */
-  
-  std::vector<G4double> refractiveIndexWLSfiber =
-    { 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60,
-      1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60,
-      1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60,
-      1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60,
-      1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60, 1.60};
-  
-  assert(sizeof(refractiveIndexWLSfiber) == sizeof(photonEnergy));
-  
-  std::vector<G4double> absWLSfiber =
-    {5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,
-     5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,
-     5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,5.40*m,1.10*m,
-     1.10*m,1.10*m,1.10*m,1.10*m,1.10*m,1.10*m, 1.*mm, 1.*mm, 1.*mm, 1.*mm,
-     1.*mm, 1.*mm, 1.*mm, 1.*mm, 1.*mm, 1.*mm, 1.*mm, 1.*mm, 1.*mm, 1.*mm};
-  
-  assert(sizeof(absWLSfiber) == sizeof(photonEnergy));
-  
-  std::vector<G4double> emissionFib =
-    {0.05, 0.10, 0.30, 0.50, 0.75, 1.00, 1.50, 1.85, 2.30, 2.75,
-     3.25, 3.80, 4.50, 5.20, 6.00, 7.00, 8.50, 9.50, 11.1, 12.4,
-     12.9, 13.0, 12.8, 12.3, 11.1, 11.0, 12.0, 11.0, 17.0, 16.9,
-     15.0, 9.00, 2.50, 1.00, 0.05, 0.00, 0.00, 0.00, 0.00, 0.00,
-     0.00, 0.00, 0.00, 0.00, 0.00, 0.00, 0.00, 0.00, 0.00, 0.00};
-  
-  assert(sizeof(emissionFib) == sizeof(photonEnergy));
-  
-  // Add entries into properties table
-  G4MaterialPropertiesTable* mptWLSfiber = new G4MaterialPropertiesTable();
-  mptWLSfiber->AddProperty("RINDEX",photonEnergy,refractiveIndexWLSfiber);
-  mptWLSfiber->AddProperty("WLSABSLENGTH",photonEnergy,absWLSfiber);
-  mptWLSfiber->AddProperty("WLSCOMPONENT",photonEnergy,emissionFib);
-  mptWLSfiber->AddConstProperty("WLSTIMECONSTANT", 0.5*ns);
+  // Envelope for the fiber fast simulation model (kept when the geometry is rebuilt)
+  if (fFiberFastModel) {
+    if (!fiberRegion) fiberRegion = new G4Region("FiberRegion");
+    fiberRegion->AddRootLogicalVolume(CladdingLV);
+  }
 
   //
-  // Set the material properties for the optics
+  // Optical material properties, read from the property file (opticalProperties.txt).
+  // Constant spectra are stored as two-point tables shared between materials.
   //
-  fiber_mat->SetMaterialPropertiesTable(mptWLSfiber);
+  if (!opticalProperties) {
+    opticalProperties = new FPOpticalPropertyDB();
+    opticalProperties->Load(opticalPropertyFile);
+  }
+  opticalProperties->ApplyToMaterials();
+  FPOpticalControl::Instance()->ApplyYieldFactor();
+  FPOpticalControl::Instance()->SetPropertyDB(opticalProperties);
 
   
   //
@@ -677,25 +583,13 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
 							   dielectric_metal,
 							   fWrappingPolish);
   
-  G4MaterialPropertiesTable* wrappingSurfaceProperty =  new G4MaterialPropertiesTable();
-  
-  G4double p_wrapping[] = {2.00*eV, 3.47*eV};    // Since these properties do not depend on photon energies, simply take a two-element array
-  const G4int nbins = sizeof(p_wrapping)/sizeof(G4double);
-  G4double fWrappingReflectivity = 1.0;
-  G4double refl_wrapping[] = {fWrappingReflectivity, fWrappingReflectivity};
-  assert(sizeof(refl_wrapping) == sizeof(p_wrapping));
-  G4double effi_wrapping[] = {0, 0};
-  assert(sizeof(effi_wrapping) == sizeof(effi_wrapping));
-
-  wrappingSurfaceProperty->
-    AddProperty("REFLECTIVITY",p_wrapping, refl_wrapping,nbins);
-  wrappingSurfaceProperty->
-    AddProperty("EFFICIENCY",p_wrapping, effi_wrapping,nbins);
-  
-  wrappingSurface -> SetMaterialPropertiesTable(wrappingSurfaceProperty);
+  // Reflectivity and efficiency of the wrapping come from the property file
+  wrappingSurface -> SetMaterialPropertiesTable(opticalProperties->GetSurfaceTable("WrappingSurface"));
 
   // Use G4LogicalSkinSurface for one-directional photon propagation
-  new G4LogicalSkinSurface("WrappingSurface", WrappingLV, wrappingSurface);
+  for (auto WrappingLV : wrappingLVs) {
+    new G4LogicalSkinSurface("WrappingSurface", WrappingLV, wrappingSurface);
+  }
   
   // Print materials
   G4cout << *(G4Material::GetMaterialTable()) << G4endl; 
@@ -707,6 +601,29 @@ G4VPhysicalVolume* FPDetectorConstruction::Construct()
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+G4double FPDetectorConstruction::GetFiberOffset(G4int panel) const
+{
+  auto offset = fPanelFiberOffsets.find(panel);
+  return (offset != fPanelFiberOffsets.end()) ? offset->second : fFiberOffset;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPDetectorConstruction::RebuildGeometry()
+{
+  if (fGeometryModified) return;
+  fGeometryModified = true;
+
+  // Detach the fiber envelope before its volume is deleted
+  if (fiberRegion && claddingLV) fiberRegion->RemoveRootLogicalVolume(claddingLV);
+  sipmLV = fiberLV = claddingLV = nullptr;
+
+  // Broadcast, so that the workers attach their sensitive detector and model again
+  G4UImanager::GetUIpointer()->ApplyCommand("/run/reinitializeGeometry true");
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void FPDetectorConstruction::ConstructSDandField()
 {
   G4SDManager::GetSDMpointer()->SetVerboseLevel(1);
@@ -715,10 +632,24 @@ void FPDetectorConstruction::ConstructSDandField()
   auto sdManager = G4SDManager::GetSDMpointer();
   G4String SDname;
   
-  auto sipmSD = new FPSiPMSD(SDname="/sipmSD");
-  sdManager->AddNewDetector(sipmSD);
+  // Reused when the geometry is rebuilt
+  G4VSensitiveDetector* sipmSD = sdManager->FindSensitiveDetector("/sipmSD", false);
+  if (!sipmSD) {
+    sipmSD = new FPSiPMSD(SDname="/sipmSD");
+    sdManager->AddNewDetector(sipmSD);
+  }
   sipmLV->SetSensitiveDetector(sipmSD);
-  
+
+  // fast simulation models (one instance per thread) -----------------------
+  static G4ThreadLocal FPFiberFastModel* fiberModel = nullptr;
+  if (fiberRegion) {
+    if (fiberModel) {
+      fiberModel->SetFiberVolume(fiberLV);
+    } else {
+      fiberModel = new FPFiberFastModel("FiberFastModel", fiberRegion, fiberLV, cladding_mat,
+					0.5*fiberD, 0.5*fiberL);
+    }
+  }
 }
 
 // split function
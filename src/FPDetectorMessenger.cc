@@ -0,0 +1,141 @@
+/// October 19, 2026: Detector construction messenger.
+///
+///    /FP/det/fiberFastModel      : attach the WLS fiber fast simulation model
+///    /FP/det/opticalPropertyFile : file with the optical material properties
+///    /FP/det/nPanels             : number of stacked panels
+///    /FP/det/panelSpacing        : distance between the centers of adjacent panels
+///    /FP/det/fiberOffset         : fiber position along y in one panel (default from runConfig.txt)
+///    /FP/det/panelThickness      : thickness of the scintillator panels
+///
+///    The panel commands may also be used between runs: the geometry is then
+///    rebuilt by the next run.
+
+#include "globals.hh"
+
+#include "FPDetectorMessenger.hh"
+
+#include "FPDetectorConstruction.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
+#include "G4StateManager.hh"
+
+#include <sstream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPDetectorMessenger::FPDetectorMessenger(FPDetectorConstruction* FPDet)
+:FPDetector(FPDet)
+{
+  detDir = new G4UIdirectory("/FP/det/");
+  detDir->SetGuidance("Detector construction control:");
+
+  SetFiberFastModelCmd = new G4UIcmdWithABool("/FP/det/fiberFastModel", this);
+  SetFiberFastModelCmd->SetGuidance("Transport photons trapped in the WLS fiber with a fast model");
+  SetFiberFastModelCmd->SetGuidance("Toggle between runs with /param/activateModel FiberFastModel");
+  SetFiberFastModelCmd->SetGuidance("and /param/inActivateModel FiberFastModel.");
+  SetFiberFastModelCmd->SetParameterName("enable", true);
+  SetFiberFastModelCmd->SetDefaultValue(true);
+  SetFiberFastModelCmd->AvailableForStates(G4State_PreInit);
+
+  SetOpticalPropertyFileCmd = new G4UIcmdWithAString("/FP/det/opticalPropertyFile", this);
+  SetOpticalPropertyFileCmd->SetGuidance("File with the optical properties of materials and surfaces");
+  SetOpticalPropertyFileCmd->SetParameterName("fileName", false);
+  SetOpticalPropertyFileCmd->SetDefaultValue("opticalProperties.txt");
+  SetOpticalPropertyFileCmd->AvailableForStates(G4State_PreInit);
+
+  SetNumberOfPanelsCmd = new G4UIcmdWithAnInteger("/FP/det/nPanels", this);
+  SetNumberOfPanelsCmd->SetGuidance("Number of stacked panels (panel 0 at the origin, the others below)");
+  SetNumberOfPanelsCmd->SetParameterName("n", false);
+  SetNumberOfPanelsCmd->SetRange("n > 0");
+  SetNumberOfPanelsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetPanelSpacingCmd = new G4UIcmdWithADoubleAndUnit("/FP/det/panelSpacing", this);
+  SetPanelSpacingCmd->SetGuidance("Distance between the centers of adjacent panels");
+  SetPanelSpacingCmd->SetParameterName("spacing", false);
+  SetPanelSpacingCmd->SetRange("spacing > 0.");
+  SetPanelSpacingCmd->SetUnitCategory("Length");
+  SetPanelSpacingCmd->SetDefaultUnit("cm");
+  SetPanelSpacingCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetPanelThicknessCmd = new G4UIcmdWithADoubleAndUnit("/FP/det/panelThickness", this);
+  SetPanelThicknessCmd->SetGuidance("Thickness of the scintillator panels");
+  SetPanelThicknessCmd->SetParameterName("thickness", false);
+  SetPanelThicknessCmd->SetRange("thickness > 0.");
+  SetPanelThicknessCmd->SetUnitCategory("Length");
+  SetPanelThicknessCmd->SetDefaultUnit("cm");
+  SetPanelThicknessCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetFiberOffsetCmd = new G4UIcommand("/FP/det/fiberOffset", this);
+  SetFiberOffsetCmd->SetGuidance("Position of the fiber (and SiPM) along y in one panel");
+  SetFiberOffsetCmd->SetGuidance("Panels not set use the position of runConfig.txt.");
+  G4UIparameter* panel = new G4UIparameter("panel", 'i', false);
+  panel->SetParameterRange("panel >= 0");
+  SetFiberOffsetCmd->SetParameter(panel);
+  G4UIparameter* offset = new G4UIparameter("offset", 'd', false);
+  SetFiberOffsetCmd->SetParameter(offset);
+  G4UIparameter* unit = new G4UIparameter("unit", 's', true);
+  unit->SetDefaultUnit("cm");
+  SetFiberOffsetCmd->SetParameter(unit);
+  SetFiberOffsetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPDetectorMessenger::~FPDetectorMessenger()
+{
+  delete SetFiberFastModelCmd;
+  delete SetOpticalPropertyFileCmd;
+  delete SetNumberOfPanelsCmd;
+  delete SetPanelSpacingCmd;
+  delete SetPanelThicknessCmd;
+  delete SetFiberOffsetCmd;
+  delete detDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPDetectorMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{ 
+    if (command == SetFiberFastModelCmd ) {
+      FPDetector->SetFiberFastModel(SetFiberFastModelCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetOpticalPropertyFileCmd ) {
+      FPDetector->SetOpticalPropertyFile(newValues);
+    }
+
+    if (command == SetNumberOfPanelsCmd ) {
+      FPDetector->SetNumberOfPanels(SetNumberOfPanelsCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetPanelSpacingCmd ) {
+      FPDetector->SetPanelSpacing(SetPanelSpacingCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetFiberOffsetCmd ) {
+      G4int panel;
+      G4double offset;
+      G4String unit;
+      std::istringstream is(newValues);
+      is >> panel >> offset >> unit;
+      FPDetector->SetFiberOffset(panel, offset*G4UIcommand::ValueOf(unit));
+    }
+
+    if (command == SetPanelThicknessCmd ) {
+      FPDetector->SetPanelThickness(SetPanelThicknessCmd->GetNewDoubleValue(newValues));
+    }
+
+    // Between runs, the panel commands take effect with a new geometry
+    if ((command == SetNumberOfPanelsCmd || command == SetPanelSpacingCmd
+	 || command == SetFiberOffsetCmd || command == SetPanelThicknessCmd)
+	&& G4StateManager::GetStateManager()->GetCurrentState() == G4State_Idle) {
+      FPDetector->RebuildGeometry();
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
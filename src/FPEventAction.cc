@@ -13,9 +13,30 @@
 ///Updated:  Sep 23, 2020 hexc & Zachary
 ///         Added analyzing histograms for photons collected by SiPM
 /// 
+/// October 19, 2026: Per-event optical photon fate counters.
+///                   Light yield and eLoss statistics of the run (and auto-stop).
+///                   The run action fills the histograms from the event summary; events
+///                   restored from a checkpoint are skipped.
+///                   Digitization of the SiPM hits, and the raw hit stream.
+///                   Per-event count of the sampled photon trajectories.
+///                   Coincidence trigger of the panel stack: only triggered events are
+///                   digitized (one SiPM per panel) and streamed.
+///                   The number of photons of the event is the sum of the hit weights.
+///                   Energy-loss-only mode: no photons, only the eLoss and the step count.
+///                   Size of the hits collection, for the memory report.
+///
 
 #include "FPEventAction.hh"
 #include "FPRunAction.hh"
+#include "FPPhotonFates.hh"
+#include "FPSiPMDigitizer.hh"
+#include "FPHitStream.hh"
+#include "FPTrajectoryFilter.hh"
+#include "FPCoincidenceTrigger.hh"
+#include "SiPMhit.hh"
+#include "FPCheckpoint.hh"
+#include "FPOpticalControl.hh"
+#include "FPMemoryReport.hh"
 
 #include "G4RunManager.hh"
 #include "G4Event.hh"
@@ -48,6 +69,8 @@ void FPEventAction::BeginOfEventAction(const G4Event* /*evt*/)
   // Initialize the total energy loss and the total number of steps
   totalEloss = 0.0;
   totalSteps = 0;
+  fRunAction->GetPhotonFates()->BeginOfEvent();
+  fRunAction->GetTrajectoryFilter()->BeginOfEvent();
 }
 
 void FPEventAction::AddELoss(G4double eLoss)
@@ -61,6 +84,18 @@ void FPEventAction::AddELoss(G4double eLoss)
 
 void FPEventAction::EndOfEventAction(const G4Event* evt )
 {
+  // Done before the run was interrupted: already in the run summary
+  if (FPCheckpoint::Instance()->IsCompleted(evt->GetEventID())) return;
+
+  // Muon eLoss calibration: the SiPM detector is off, there are no hits
+  if (FPOpticalControl::Instance()->IsELossOnly()) {
+    G4cout << "Number of tracking steps: " << totalSteps << "     Total ELoss: " << G4BestUnit(totalEloss, "Energy")<< G4endl;
+    fRunAction->FillEventStats(evt->GetEventID(), 0, totalEloss);
+    FPMemoryReport::Instance()->EndOfEvent(0);
+    return;
+  }
+
+  fRunAction->GetPhotonFates()->EndOfEvent(evt->GetEventID());
   
   //Hits collections
   //  
@@ -74,14 +109,49 @@ void FPEventAction::EndOfEventAction(const G4Event* evt )
   auto hc = HCE->GetHC(HCID);
   if (hc->GetSize() > 0) {
     G4cout << "The size of the Hit Collection of This Event: " << hc->GetSize() << G4endl;
-    fRunAction->CountPhoton();
+  }
+
+  // Coincidence of the panels
+  FPCoincidenceTrigger* trigger = fRunAction->GetTrigger();
+  G4bool triggered = true;
+  if (trigger->IsEnabled()) {
+    triggered = trigger->EndOfEvent(static_cast<SiPMHitCollection*>(hc));
+    G4cout << "Coincidence: " << trigger->GetFiredPanels() << " of " << trigger->GetNumberOfPanels()
+	   << " panels" << (triggered ? ", triggered" : "") << G4endl;
+  }
+
+  // SiPM signal of the event, one SiPM per panel
+  FPSiPMDigitizer* digitizer = fRunAction->GetDigitizer();
+  if (triggered && digitizer->IsEnabled()) {
+    G4int nPanels = trigger->GetNumberOfPanels();
+    if (nPanels > 1) {
+      for (G4int panel = 0; panel < nPanels; panel++) {
+	digitizer->Digitize(static_cast<SiPMHitCollection*>(hc), panel);
+      }
+    } else {
+      digitizer->Digitize(static_cast<SiPMHitCollection*>(hc));
+    }
+  }
+  // Every detected photon, to the raw stream of the thread
+  FPHitStream* hitStream = fRunAction->GetHitStream();
+  if (triggered && hitStream->IsEnabled()) {
+    hitStream->AddEvent(evt->GetEventID(), static_cast<SiPMHitCollection*>(hc));
   }
 
   G4cout << "Number of tracking steps: " << totalSteps << "     Total ELoss: " << G4BestUnit(totalEloss, "Energy")<< G4endl;
 
-  G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
-  analysisManager->FillH1(0, hc->GetSize());
-  analysisManager->FillH1(1, totalEloss);
+  // Histograms, run statistics and checkpoint
+  // Photons cut by a roulette are made up by the weight of the survivors;
+  // those killed by an early trigger decision are not
+  G4double nPhotons = 0.;
+  for (std::size_t i = 0; i < hc->GetSize(); i++) {
+    nPhotons += static_cast<SiPMHit*>(hc->GetHit(i))->GetWeight();
+  }
+  G4bool cutShort = trigger->IsEnabled() && trigger->IsCutShort();
+  fRunAction->FillEventStats(evt->GetEventID(),
+			     cutShort ? FPEventRecord::kPhotonsNotCounted : G4int(G4lrint(nPhotons)),
+			     totalEloss);
+  FPMemoryReport::Instance()->EndOfEvent(hc->GetSize());
 
   /*
   G4THitsMap<G4int>* evtMap =  (G4THitsMap<G4int>*)(HCE->GetHC(HCID));
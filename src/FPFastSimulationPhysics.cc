@@ -0,0 +1,34 @@
+/// October 19, 2026: Fast simulation of the optical photons, for the WLS
+///    fiber model only.
+
+#include "FPFastSimulationPhysics.hh"
+#include "FPDetectorConstruction.hh"
+
+#include "G4RunManager.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPFastSimulationPhysics::FPFastSimulationPhysics()
+  : G4FastSimulationPhysics()
+{
+  ActivateFastSimulation("opticalphoton");
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPFastSimulationPhysics::~FPFastSimulationPhysics()
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPFastSimulationPhysics::ConstructProcess()
+{
+  // Workers share the detector construction of the master
+  auto detector = dynamic_cast<const FPDetectorConstruction*>(
+    G4RunManager::GetRunManager()->GetUserDetectorConstruction());
+  if (!detector || !detector->IsFiberFastModel()) return;
+
+  G4FastSimulationPhysics::ConstructProcess();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
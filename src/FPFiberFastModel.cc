@@ -0,0 +1,188 @@
+/// October 19, 2026: Fast simulation model for the WLS fiber.
+///
+///    Trapping condition for a straight cylindrical core of radius R, for a
+///    ray with direction d emitted at transverse position (x, y): the cosine
+///    of the angle of incidence on the wall is
+///        cos^2(alpha) = (dx^2 + dy^2) - (x*dy - y*dx)^2 / R^2
+///    and is the same at every reflection. Total internal reflection at the
+///    core/cladding interface requires cos^2(alpha) <= 1 - (n_clad/n_core)^2.
+
+#include "FPFiberFastModel.hh"
+#include "FPOpticalControl.hh"
+
+#include "G4FastTrack.hh"
+#include "G4FastStep.hh"
+#include "G4Track.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4ProcessTable.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPFiberFastModel::FPFiberFastModel(const G4String& name, G4Region* envelope,
+				   const G4LogicalVolume* fiberLV,
+				   const G4Material* claddingMaterial,
+				   G4double coreRadius, G4double halfLength)
+  : G4VFastSimulationModel(name, envelope),
+    fFiberLV(fiberLV),
+    fCladdingMaterial(claddingMaterial),
+    fCoreRadius(coreRadius),
+    fHalfLength(halfLength),
+    fCoreIndex(1.0),
+    fMaxWallCosine2(0.0),
+    fAttenuation(nullptr),
+    fGroupVelocity(nullptr),
+    fWLSProcess(nullptr),
+    fPropertyGeneration(FPOpticalControl::Instance()->GetPropertyGeneration()),
+    fNTrapped(0),
+    fNAbsorbed(0)
+{
+  BuildTables();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPFiberFastModel::~FPFiberFastModel()
+{
+  G4cout << "FiberFastModel: " << fNTrapped << " trapped WLS photons transported, "
+	 << fNAbsorbed << " of them absorbed in the fiber" << G4endl;
+  delete fAttenuation;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPFiberFastModel::BuildTables()
+{
+  G4MaterialPropertiesTable* coreMPT = fFiberLV->GetMaterial()->GetMaterialPropertiesTable();
+  G4MaterialPropertiesTable* cladMPT = fCladdingMaterial->GetMaterialPropertiesTable();
+  G4MaterialPropertyVector* coreIndex = coreMPT ? coreMPT->GetProperty("RINDEX") : nullptr;
+  G4MaterialPropertyVector* cladIndex = cladMPT ? cladMPT->GetProperty("RINDEX") : nullptr;
+  G4MaterialPropertyVector* wlsLength = coreMPT ? coreMPT->GetProperty("WLSABSLENGTH") : nullptr;
+
+  if (!coreIndex || !cladIndex || !wlsLength
+      || coreIndex->GetVectorLength() == 0 || cladIndex->GetVectorLength() == 0) {
+    G4Exception("FPFiberFastModel::BuildTables()", "FPFiber001", FatalException,
+		"Fiber or cladding material lacks RINDEX or WLSABSLENGTH");
+    return;
+  }
+
+  // The trapping condition is decided once: the model assumes constant indices.
+  // GetMinValue()/GetMaxValue() are the first and last points only, so the
+  // extrema are taken over every point.
+  G4double coreMin = (*coreIndex)[0], coreMax = coreMin;
+  for (std::size_t i = 1; i < coreIndex->GetVectorLength(); i++) {
+    coreMin = std::min(coreMin, (*coreIndex)[i]);
+    coreMax = std::max(coreMax, (*coreIndex)[i]);
+  }
+  G4double cladMin = (*cladIndex)[0], cladMax = cladMin;
+  for (std::size_t i = 1; i < cladIndex->GetVectorLength(); i++) {
+    cladMin = std::min(cladMin, (*cladIndex)[i]);
+    cladMax = std::max(cladMax, (*cladIndex)[i]);
+  }
+  if (coreMin != coreMax || cladMin != cladMax) {
+    G4Exception("FPFiberFastModel::BuildTables()", "FPFiber002", JustWarning,
+		"Fiber refractive indices are not constant, using the maximum values");
+  }
+  fCoreIndex = coreMax;
+  G4double ratio = cladMax/fCoreIndex;
+  fMaxWallCosine2 = 1.0 - ratio*ratio;
+
+  // Time of flight: photons travel at the group velocity, which GEANT4
+  // derives from RINDEX; c/n for a constant index
+  fGroupVelocity = coreMPT->GetProperty("GROUPVEL");
+  fGroupVelocityLookup.SetVector(fGroupVelocity);
+
+  // Attenuation along the fiber: re-absorption by the WLS dye and bulk absorption
+  G4MaterialPropertyVector* absLength = coreMPT->GetProperty("ABSLENGTH");
+  std::size_t nEntries = wlsLength->GetVectorLength();
+  delete fAttenuation;
+  fAttenuation = new G4PhysicsFreeVector(nEntries);
+  fAttenuationLookup.SetVector(fAttenuation);
+  for (std::size_t i = 0; i < nEntries; i++) {
+    G4double energy = wlsLength->Energy(i);
+    G4double invLength = 1.0/(*wlsLength)[i];
+    if (absLength) invLength += 1.0/absLength->Value(energy);
+    fAttenuation->PutValues(i, energy, 1.0/invLength);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPFiberFastModel::IsApplicable(const G4ParticleDefinition& particle)
+{
+  return &particle == G4OpticalPhoton::Definition();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPFiberFastModel::ModelTrigger(const G4FastTrack& fastTrack)
+{
+  // Only photons just re-emitted by WLS in the fiber core
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  if (track->GetCurrentStepNumber() != 1) return false;
+
+  if (!fWLSProcess) {
+    fWLSProcess = G4ProcessTable::GetProcessTable()->FindProcess("OpWLS", G4OpticalPhoton::Definition());
+    if (!fWLSProcess) return false;
+  }
+  if (track->GetCreatorProcess() != fWLSProcess) return false;
+  if (track->GetVolume()->GetLogicalVolume() != fFiberLV) return false;
+
+  G4ThreeVector pos = fastTrack.GetPrimaryTrackLocalPosition();
+  G4ThreeVector dir = fastTrack.GetPrimaryTrackLocalDirection();
+  if (dir.z() == 0.) return false;
+
+  G4double transverse2 = dir.x()*dir.x() + dir.y()*dir.y();
+  G4double skew = (pos.x()*dir.y() - pos.y()*dir.x())/fCoreRadius;
+  G4double wallCosine2 = transverse2 - skew*skew;
+
+  return wallCosine2 <= fMaxWallCosine2;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPFiberFastModel::DoIt(const G4FastTrack& fastTrack, G4FastStep& fastStep)
+{
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  G4ThreeVector pos = fastTrack.GetPrimaryTrackLocalPosition();
+  G4ThreeVector dir = fastTrack.GetPrimaryTrackLocalDirection();
+
+  // Attenuation lengths changed between runs (/FP/optical/setProperty)
+  G4int generation = FPOpticalControl::Instance()->GetPropertyGeneration();
+  if (generation != fPropertyGeneration) {
+    fPropertyGeneration = generation;
+    BuildTables();
+  }
+
+  fNTrapped++;
+  fastStep.ProposeTotalEnergyDeposited(0.);
+
+  // Path length to the end the photon is heading to: the axial distance
+  // divided by the cosine with the axis, whatever the number of reflections
+  G4double sign = (dir.z() > 0.) ? 1.0 : -1.0;
+  G4double endZ = sign*(fHalfLength - 1.*um);
+  G4double pathLength = (endZ - pos.z())/dir.z();
+
+  G4double energy = track->GetKineticEnergy();
+  G4double attenuation = fAttenuationLookup.Value(energy);
+  if (-attenuation*std::log(G4UniformRand()) < pathLength) {
+    fNAbsorbed++;
+    fastStep.KillPrimaryTrack();
+    return;
+  }
+
+  fastStep.ProposePrimaryTrackFinalPosition(G4ThreeVector(pos.x(), pos.y(), endZ), true);
+  fastStep.ProposePrimaryTrackFinalMomentumDirection(dir, true);
+  G4double velocity = fGroupVelocity ? fGroupVelocityLookup.Value(energy) : c_light/fCoreIndex;
+  fastStep.ProposePrimaryTrackFinalTime(track->GetGlobalTime() + pathLength/velocity);
+  fastStep.ProposePrimaryTrackPathLength(pathLength);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,239 @@
+/// October 19, 2026: Geometry and optical variants run in forked processes.
+
+#include "FPForkDriver.hh"
+#include "FPForkDriverMessenger.hh"
+#include "FPRunAction.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4RunManager.hh"
+#include "G4RunManagerKernel.hh"
+#include "G4StateManager.hh"
+#include "G4UImanager.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPForkDriver* FPForkDriver::Instance()
+{
+  // Created in main() and kept for the whole job
+  static FPForkDriver* instance = new FPForkDriver();
+  return instance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPForkDriver::FPForkDriver()
+  : fMaxProcesses(0),
+    fSummaryFile("variants.txt")
+{
+  fMessenger = new FPForkDriverMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPForkDriver::~FPForkDriver()
+{
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPForkDriver::AddVariant(const G4String& name, const G4String& macro)
+{
+  for (const Variant& variant : fVariants) {
+    if (variant.name == name) {
+      G4ExceptionDescription msg;
+      msg << "Variant " << name << " already defined: ignored.";
+      G4Exception("FPForkDriver::AddVariant()", "FPFork002", JustWarning, msg);
+      return;
+    }
+  }
+  fVariants.push_back({ name, macro });
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPForkDriver::BeamOn(G4int nEvents)
+{
+  G4RunManager* runManager = G4RunManager::GetRunManager();
+  if (runManager->GetRunManagerType() != G4RunManager::sequentialRM) {
+    G4Exception("FPForkDriver::BeamOn()", "FPFork001", JustWarning,
+		"Forking needs the sequential run manager: start fiberPanel with -j <nProcesses>.");
+    return;
+  }
+  if (fVariants.empty()) {
+    G4Exception("FPForkDriver::BeamOn()", "FPFork001", JustWarning,
+		"No variant defined (/FP/fork/variant).");
+    return;
+  }
+
+  BuildPhysicsTables();
+
+  G4int maxProcesses = fMaxProcesses;
+  if (maxProcesses <= 0) maxProcesses = std::max(1u, std::thread::hardware_concurrency());
+
+  // Nothing buffered may be written twice by the children
+  G4cout << G4endl << " Forking " << fVariants.size() << " variants, " << maxProcesses
+	 << " at a time, " << nEvents << " events each" << G4endl;
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  std::vector<Result> results(fVariants.size(), Result());
+  std::vector<G4bool> done(fVariants.size(), false);
+  std::map<pid_t, std::pair<std::size_t, int> > running;    // variant and pipe
+  std::size_t next = 0;
+
+  while (next < fVariants.size() || !running.empty()) {
+    // Start variants while slots are free
+    while (next < fVariants.size() && (G4int) running.size() < maxProcesses) {
+      int fds[2];
+      if (pipe(fds) != 0) break;
+      pid_t pid = fork();
+      if (pid == 0) {
+	close(fds[0]);
+	RunVariant(fVariants[next], nEvents, fds[1]);
+      }
+      close(fds[1]);
+      if (pid < 0) {
+	close(fds[0]);
+	break;
+      }
+      running[pid] = std::make_pair(next, fds[0]);
+      next++;
+    }
+    if (running.empty()) {
+      G4Exception("FPForkDriver::BeamOn()", "FPFork003", JustWarning,
+		  "Cannot fork: the variants left are not run.");
+      break;
+    }
+
+    // Collect a finished child
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    auto child = running.find(pid);
+    if (child == running.end()) continue;
+
+    std::size_t index = child->second.first;
+    int fd = child->second.second;
+    Result result;
+    G4bool received = (read(fd, &result, sizeof(result)) == (ssize_t) sizeof(result));
+    close(fd);
+    running.erase(child);
+
+    if (received && WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+      results[index] = result;
+      done[index] = true;
+    } else {
+      G4ExceptionDescription msg;
+      msg << "Variant " << fVariants[index].name << " failed, see "
+	  << fVariants[index].name << "/fiberPanel.log";
+      G4Exception("FPForkDriver::BeamOn()", "FPFork004", JustWarning, msg);
+    }
+  }
+
+  Report(results, done);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPForkDriver::BuildPhysicsTables() const
+{
+  // As at the beginning of a run; the children find the tables up to date
+  // as long as they do not change the materials or the cuts
+  G4StateManager* stateManager = G4StateManager::GetStateManager();
+  G4RunManagerKernel* kernel = G4RunManagerKernel::GetRunManagerKernel();
+  stateManager->SetNewState(G4State_Init);
+  kernel->UpdateRegion();
+  kernel->BuildPhysicsTables(true);
+  stateManager->SetNewState(G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPForkDriver::RunVariant(const Variant& variant, G4int nEvents, int resultPipe) const
+{
+  // Output of the variant in its own directory
+  mkdir(variant.name.c_str(), 0755);
+  G4String logName = variant.name + "/fiberPanel.log";
+  int log = open(logName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (log >= 0) {
+    dup2(log, STDOUT_FILENO);
+    dup2(log, STDERR_FILENO);
+    close(log);
+  }
+
+  // The macro path is relative to the directory of the parent
+  G4UImanager* UImanager = G4UImanager::GetUIpointer();
+  if (UImanager->ApplyCommand("/control/execute " + variant.macro) != 0) _exit(2);
+  if (chdir(variant.name.c_str()) != 0) _exit(3);
+
+  auto start = std::chrono::steady_clock::now();
+  G4RunManager* runManager = G4RunManager::GetRunManager();
+  runManager->BeamOn(nEvents);
+  auto stop = std::chrono::steady_clock::now();
+
+  auto runAction = dynamic_cast<const FPRunAction*>(runManager->GetUserRunAction());
+  if (!runAction) _exit(4);
+
+  Result result;
+  result.nEvents         = runAction->GetELoss().GetN();
+  result.lightYield      = runAction->GetLightYield().GetMean();
+  result.lightYieldError = runAction->GetLightYield().GetError();
+  result.eLoss           = runAction->GetELoss().GetMean();
+  result.eLossError      = runAction->GetELoss().GetError();
+  result.seconds         = std::chrono::duration<G4double>(stop - start).count();
+  G4bool sent = (write(resultPipe, &result, sizeof(result)) == (ssize_t) sizeof(result));
+  close(resultPipe);
+
+  // Leave without the destructors of the state shared with the parent
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+  _exit(sent ? 0 : 5);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPForkDriver::Report(const std::vector<Result>& results, const std::vector<G4bool>& done) const
+{
+  std::ofstream summary(fSummaryFile);
+  summary << "# variant\tevents\tlightYield\terror\teLoss[MeV]\terror\tseconds" << std::endl;
+
+  G4cout << G4endl << " Variants:" << G4endl
+	 << "   variant              events   light yield (photons)      eLoss (MeV)     time (s)"
+	 << G4endl;
+  FPPrecisionGuard precisionGuard;
+  for (std::size_t i = 0; i < fVariants.size(); i++) {
+    G4cout << "   " << std::left << std::setw(20) << fVariants[i].name << std::right;
+    if (!done[i]) {
+      G4cout << "   failed" << G4endl;
+      continue;
+    }
+    const Result& result = results[i];
+    G4cout << std::setw(8) << result.nEvents << std::setprecision(4)
+	   << std::setw(12) << result.lightYield << " +- " << std::setw(8) << result.lightYieldError
+	   << std::setw(10) << result.eLoss/MeV << " +- " << std::setw(8) << result.eLossError/MeV
+	   << std::setw(10) << result.seconds << G4endl;
+    summary << fVariants[i].name << "\t" << result.nEvents << "\t"
+	    << result.lightYield << "\t" << result.lightYieldError << "\t"
+	    << result.eLoss/MeV << "\t" << result.eLossError/MeV << "\t" << result.seconds << std::endl;
+  }
+  G4cout << " Results written to " << fSummaryFile << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
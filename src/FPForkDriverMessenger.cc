@@ -0,0 +1,110 @@
+/// October 19, 2026: Fork driver messenger.
+///
+///    /FP/fork/variant       : add a variant, with the macro that sets it up
+///    /FP/fork/clearVariants : forget the variants
+///    /FP/fork/maxProcesses  : number of variants run at the same time (0: number of cores)
+///    /FP/fork/summaryFile   : file with the results of all the variants
+///    /FP/fork/beamOn        : run every variant in a forked process
+///
+///    The driver runs in the (single-threaded) master: the commands are not broadcast.
+
+#include "globals.hh"
+
+#include "FPForkDriverMessenger.hh"
+
+#include "FPForkDriver.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithoutParameter.hh"
+#include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
+
+#include <sstream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPForkDriverMessenger::FPForkDriverMessenger(FPForkDriver* FPDriver)
+:FPFork(FPDriver)
+{
+  forkDir = new G4UIdirectory("/FP/fork/");
+  forkDir->SetGuidance("Variants run in processes forked after the initialization (fiberPanel -j):");
+
+  AddVariantCmd = new G4UIcommand("/FP/fork/variant", this);
+  AddVariantCmd->SetGuidance("Add a variant: its name (also its output directory) and the macro");
+  AddVariantCmd->SetGuidance("setting it up, e.g. /FP/det/fiberOffset or /FP/det/panelThickness.");
+  AddVariantCmd->SetParameter(new G4UIparameter("name", 's', false));
+  AddVariantCmd->SetParameter(new G4UIparameter("macro", 's', false));
+  AddVariantCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  AddVariantCmd->SetToBeBroadcasted(false);
+
+  ClearVariantsCmd = new G4UIcmdWithoutParameter("/FP/fork/clearVariants", this);
+  ClearVariantsCmd->SetGuidance("Forget the variants added so far");
+  ClearVariantsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  ClearVariantsCmd->SetToBeBroadcasted(false);
+
+  SetMaxProcessesCmd = new G4UIcmdWithAnInteger("/FP/fork/maxProcesses", this);
+  SetMaxProcessesCmd->SetGuidance("Number of variants run at the same time (0: number of cores)");
+  SetMaxProcessesCmd->SetParameterName("n", false);
+  SetMaxProcessesCmd->SetRange("n >= 0");
+  SetMaxProcessesCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetMaxProcessesCmd->SetToBeBroadcasted(false);
+
+  SetSummaryFileCmd = new G4UIcmdWithAString("/FP/fork/summaryFile", this);
+  SetSummaryFileCmd->SetGuidance("File with the results of all the variants");
+  SetSummaryFileCmd->SetParameterName("fileName", false);
+  SetSummaryFileCmd->SetDefaultValue("variants.txt");
+  SetSummaryFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetSummaryFileCmd->SetToBeBroadcasted(false);
+
+  BeamOnCmd = new G4UIcmdWithAnInteger("/FP/fork/beamOn", this);
+  BeamOnCmd->SetGuidance("Build the physics tables, then run the events of every variant");
+  BeamOnCmd->SetGuidance("in its own forked process, and report the results.");
+  BeamOnCmd->SetParameterName("nEvents", false);
+  BeamOnCmd->SetRange("nEvents > 0");
+  BeamOnCmd->AvailableForStates(G4State_Idle);
+  BeamOnCmd->SetToBeBroadcasted(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPForkDriverMessenger::~FPForkDriverMessenger()
+{
+  delete AddVariantCmd;
+  delete ClearVariantsCmd;
+  delete SetMaxProcessesCmd;
+  delete SetSummaryFileCmd;
+  delete BeamOnCmd;
+  delete forkDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPForkDriverMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == AddVariantCmd ) {
+      G4String name;
+      G4String macro;
+      std::istringstream is(newValues);
+      is >> name >> macro;
+      FPFork->AddVariant(name, macro);
+    }
+
+    if (command == ClearVariantsCmd ) {
+      FPFork->ClearVariants();
+    }
+
+    if (command == SetMaxProcessesCmd ) {
+      FPFork->SetMaxProcesses(SetMaxProcessesCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetSummaryFileCmd ) {
+      FPFork->SetSummaryFile(newValues);
+    }
+
+    if (command == BeamOnCmd ) {
+      FPFork->BeamOn(BeamOnCmd->GetNewIntValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,363 @@
+/// October 19, 2026: Raw stream of the detected photons.
+///
+///    Stream file (little endian):
+///      char[8]   "FPHITS1"
+///      int32     run ID, thread ID
+///      chunks:   char[4] "FPHC", uint32 nEvents, nHits, raw size, stored size,
+///                uint32 flags (1: zlib), then the stored bytes
+///    Raw chunk content, per event (values reset at each event):
+///      varint    event ID, number of hits
+///      per hit:  varint channel, then zigzag varints of the differences to
+///                the previous hit of time (ps), x, y, z (um), then varint
+///                wavelength (0.01 nm)
+///    Index file:
+///      char[8]   "FPHIDX1"
+///      per event: int32 event ID, uint64 chunk offset, uint32 event offset,
+///                 in increasing event ID order (a thread processes its
+///                 events in that order)
+
+#include "FPHitStream.hh"
+#include "FPHitStreamMessenger.hh"
+
+#include "G4AutoLock.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+
+#include "zlib.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+namespace {
+
+  const char streamMagic[8] = "FPHITS1";
+  const char indexMagic[8]  = "FPHIDX1";
+  const char chunkMagic[4]  = { 'F','P','H','C' };
+
+  const G4double timeUnit       = 1.*picosecond;
+  const G4double positionUnit   = 1.*um;
+  const G4double wavelengthUnit = 0.01*nm;
+
+  inline void PutVarint(std::string& out, uint64_t value)
+  {
+    while (value >= 0x80) {
+      out.push_back((char) (value | 0x80));
+      value >>= 7;
+    }
+    out.push_back((char) value);
+  }
+
+  inline void PutSigned(std::string& out, int64_t value)
+  {
+    PutVarint(out, ((uint64_t) value << 1) ^ (uint64_t) (value >> 63));
+  }
+
+  inline G4bool GetVarint(const std::string& in, std::size_t& pos, uint64_t& value)
+  {
+    value = 0;
+    for (G4int shift = 0; pos < in.size() && shift < 64; shift += 7) {
+      uint8_t byte = in[pos++];
+      value |= (uint64_t) (byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+    return false;
+  }
+
+  inline G4bool GetSigned(const std::string& in, std::size_t& pos, int64_t& value)
+  {
+    uint64_t raw;
+    if (!GetVarint(in, pos, raw)) return false;
+    value = (int64_t) (raw >> 1) ^ -(int64_t) (raw & 1);
+    return true;
+  }
+
+  template <class T> void WriteValue(std::ostream& out, const T& value)
+  {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <class T> G4bool ReadValue(std::istream& in, T& value)
+  {
+    return (G4bool) in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPHitStream::FPHitStream()
+  : fEnabled(false),
+    fFileName("fiberPanelHits"),
+    fCompression(true),
+    fChunkSize(1 << 20),
+    fRunID(0),
+    fOpen(false),
+    fHasPending(false),
+    fStopping(false),
+    fOffset(0)
+{
+  fMessenger = new FPHitStreamMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPHitStream::~FPHitStream()
+{
+  EndOfRun();
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStream::BeginOfRun(G4int runID)
+{
+  fRunID = runID;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStream::Open()
+{
+  std::ostringstream name;
+  name << fFileName << ".run" << fRunID << ".t" << std::max(G4Threading::G4GetThreadId(), 0)
+       << ".hits";
+  fOut.open(name.str(), std::ios::binary | std::ios::trunc);
+  fIndex.open(name.str() + ".idx", std::ios::binary | std::ios::trunc);
+  if (!fOut || !fIndex) {
+    G4ExceptionDescription msg;
+    msg << "Can not write the hit stream " << name.str() << ", stream disabled";
+    G4Exception("FPHitStream::Open()", "FPHits001", JustWarning, msg);
+    fOut.close();
+    fIndex.close();
+    fEnabled = false;
+    return;
+  }
+
+  fOut.write(streamMagic, sizeof(streamMagic));
+  WriteValue(fOut, (int32_t) fRunID);
+  WriteValue(fOut, (int32_t) std::max(G4Threading::G4GetThreadId(), 0));
+  fIndex.write(indexMagic, sizeof(indexMagic));
+  fOffset = fOut.tellp();
+
+  fFilling.Clear();
+  fPending.Clear();
+  fHasPending = false;
+  fStopping = false;
+  fOpen = true;
+  fWriter = std::thread(&FPHitStream::WriterLoop, this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStream::AddEvent(G4int eventID, const SiPMHitCollection* hits)
+{
+  if (!fOpen) {
+    if (!fEnabled) return;
+    Open();
+    if (!fOpen) return;
+  }
+
+  std::string& out = fFilling.data;
+  fFilling.eventIDs.push_back(eventID);
+  fFilling.eventOffsets.push_back(out.size());
+
+  std::size_t nHits = hits ? hits->entries() : 0;
+  PutVarint(out, (uint32_t) eventID);
+  PutVarint(out, nHits);
+  int64_t lastTime = 0, lastX = 0, lastY = 0, lastZ = 0;
+  for (std::size_t i = 0; i < nHits; i++) {
+    const SiPMHit* hit = (*hits)[i];
+    int64_t time = std::llround(hit->GetTime()/timeUnit);
+    int64_t x = std::llround(hit->GetPosition().x()/positionUnit);
+    int64_t y = std::llround(hit->GetPosition().y()/positionUnit);
+    int64_t z = std::llround(hit->GetPosition().z()/positionUnit);
+    uint64_t wavelength = (hit->GetEnergy() > 0.)
+      ? std::llround(h_Planck*c_light/hit->GetEnergy()/wavelengthUnit) : 0;
+
+    PutVarint(out, (uint32_t) hit->GetChannel());
+    PutSigned(out, time - lastTime);
+    PutSigned(out, x - lastX);
+    PutSigned(out, y - lastY);
+    PutSigned(out, z - lastZ);
+    PutVarint(out, wavelength);
+    lastTime = time;
+    lastX = x;
+    lastY = y;
+    lastZ = z;
+  }
+  fFilling.nHits += nHits;
+
+  if (out.size() >= (std::size_t) fChunkSize) Submit(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStream::Submit(G4bool last)
+{
+  G4AutoLock lock(&fMutex);
+  if (last) {
+    // End of run: the only place where the simulation thread waits
+    fCondition.wait(lock, [this] { return !fHasPending; });
+  } else if (fHasPending) {
+    // Writer still busy: keep filling the current chunk
+    return;
+  }
+  std::swap(fFilling, fPending);
+  fHasPending = !fPending.eventIDs.empty();
+  fStopping = last;
+  lock.unlock();
+  fCondition.notify_all();
+  fFilling.Clear();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStream::WriterLoop()
+{
+  G4AutoLock lock(&fMutex);
+  while (true) {
+    fCondition.wait(lock, [this] { return fHasPending || fStopping; });
+    if (fHasPending) {
+      // The simulation thread does not touch fPending until it is released
+      lock.unlock();
+      WriteChunk(fPending);
+      fPending.Clear();
+      lock.lock();
+      fHasPending = false;
+      fCondition.notify_all();
+    }
+    if (fStopping && !fHasPending) break;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStream::WriteChunk(const Chunk& chunk)
+{
+  const std::string* stored = &chunk.data;
+  uint32_t flags = 0;
+  if (fCompression && !chunk.data.empty()) {
+    uLongf size = compressBound(chunk.data.size());
+    fCompressed.resize(size);
+    if (compress2(reinterpret_cast<Bytef*>(&fCompressed[0]), &size,
+		  reinterpret_cast<const Bytef*>(chunk.data.data()), chunk.data.size(),
+		  Z_BEST_SPEED) == Z_OK && size < chunk.data.size()) {
+      fCompressed.resize(size);
+      stored = &fCompressed;
+      flags = 1;
+    }
+  }
+
+  fOut.write(chunkMagic, sizeof(chunkMagic));
+  WriteValue(fOut, (uint32_t) chunk.eventIDs.size());
+  WriteValue(fOut, chunk.nHits);
+  WriteValue(fOut, (uint32_t) chunk.data.size());
+  WriteValue(fOut, (uint32_t) stored->size());
+  WriteValue(fOut, flags);
+  fOut.write(stored->data(), stored->size());
+
+  for (std::size_t i = 0; i < chunk.eventIDs.size(); i++) {
+    WriteValue(fIndex, (int32_t) chunk.eventIDs[i]);
+    WriteValue(fIndex, fOffset);
+    WriteValue(fIndex, chunk.eventOffsets[i]);
+  }
+  fOffset += sizeof(chunkMagic) + 5*sizeof(uint32_t) + stored->size();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStream::EndOfRun()
+{
+  if (!fOpen) return;
+  Submit(true);
+  fWriter.join();
+  fOut.close();
+  fIndex.close();
+  fOpen = false;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPHitStream::ReadEvent(const G4String& fileName, G4int eventID,
+			      std::vector<FPStreamHit>& hits)
+{
+  hits.clear();
+
+  // Find the event in the index: a binary search, the entries have a fixed
+  // size and are sorted by event ID
+  std::ifstream index(fileName + ".idx", std::ios::binary);
+  char magic[8];
+  if (!index.read(magic, sizeof(magic)) || std::memcmp(magic, indexMagic, sizeof(magic)) != 0) {
+    return false;
+  }
+  const std::streamoff entrySize = sizeof(int32_t) + sizeof(uint64_t) + sizeof(uint32_t);
+  index.seekg(0, std::ios::end);
+  std::streamoff low = 0;
+  std::streamoff high = (std::streamoff(index.tellg()) - std::streamoff(sizeof(magic)))/entrySize;
+  int32_t id;
+  uint64_t chunkOffset;
+  uint32_t eventOffset;
+  G4bool found = false;
+  while (low < high && !found) {
+    std::streamoff middle = low + (high - low)/2;
+    index.seekg(sizeof(magic) + middle*entrySize);
+    if (!ReadValue(index, id) || !ReadValue(index, chunkOffset) || !ReadValue(index, eventOffset)) {
+      return false;
+    }
+    if (id == eventID)     found = true;
+    else if (id < eventID) low = middle + 1;
+    else                   high = middle;
+  }
+  if (!found) return false;
+
+  // Read and expand its chunk
+  std::ifstream in(fileName, std::ios::binary);
+  char chunkHeader[4];
+  uint32_t nEvents, nHits, rawSize, storedSize, flags;
+  in.seekg(chunkOffset);
+  if (!in.read(chunkHeader, sizeof(chunkHeader))
+      || std::memcmp(chunkHeader, chunkMagic, sizeof(chunkMagic)) != 0
+      || !ReadValue(in, nEvents) || !ReadValue(in, nHits) || !ReadValue(in, rawSize)
+      || !ReadValue(in, storedSize) || !ReadValue(in, flags)) return false;
+  std::string stored(storedSize, '\0');
+  if (storedSize > 0 && !in.read(&stored[0], storedSize)) return false;
+  std::string data;
+  if (flags & 1) {
+    data.resize(rawSize);
+    uLongf size = rawSize;
+    if (uncompress(reinterpret_cast<Bytef*>(&data[0]), &size,
+		   reinterpret_cast<const Bytef*>(stored.data()), storedSize) != Z_OK
+	|| size != rawSize) return false;
+  } else {
+    data.swap(stored);
+  }
+
+  // Decode the event
+  std::size_t pos = eventOffset;
+  uint64_t storedID, count;
+  if (!GetVarint(data, pos, storedID) || !GetVarint(data, pos, count)
+      || (G4int) storedID != eventID) return false;
+  int64_t time = 0, x = 0, y = 0, z = 0;
+  for (uint64_t i = 0; i < count; i++) {
+    uint64_t channel, wavelength;
+    int64_t dt, dx, dy, dz;
+    if (!GetVarint(data, pos, channel) || !GetSigned(data, pos, dt) || !GetSigned(data, pos, dx)
+	|| !GetSigned(data, pos, dy) || !GetSigned(data, pos, dz)
+	|| !GetVarint(data, pos, wavelength)) return false;
+    time += dt;
+    x += dx;
+    y += dy;
+    z += dz;
+    FPStreamHit hit;
+    hit.channel = channel;
+    hit.time = time*timeUnit;
+    hit.position = G4ThreeVector(x*positionUnit, y*positionUnit, z*positionUnit);
+    hit.wavelength = wavelength*wavelengthUnit;
+    hits.push_back(hit);
+  }
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
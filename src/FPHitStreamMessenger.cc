@@ -0,0 +1,83 @@
+/// October 19, 2026: Hit stream messenger.
+///
+///    /FP/hits/enable    : write every detected photon to the per-thread stream files
+///    /FP/hits/fileName  : prefix of the stream files
+///    /FP/hits/compress  : zlib compression of the chunks
+///    /FP/hits/chunkSize : size of the chunks handed to the writer thread (bytes)
+
+#include "globals.hh"
+
+#include "FPHitStreamMessenger.hh"
+
+#include "FPHitStream.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPHitStreamMessenger::FPHitStreamMessenger(FPHitStream* FPHits)
+:FPStream(FPHits)
+{
+  hitsDir = new G4UIdirectory("/FP/hits/");
+  hitsDir->SetGuidance("Raw stream of the detected photons:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/hits/enable", this);
+  SetEnableCmd->SetGuidance("Write every detected photon to the per-thread stream files");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetFileNameCmd = new G4UIcmdWithAString("/FP/hits/fileName", this);
+  SetFileNameCmd->SetGuidance("Prefix of the stream files (<prefix>.runR.tT.hits)");
+  SetFileNameCmd->SetParameterName("fileName", false);
+  SetFileNameCmd->SetDefaultValue("fiberPanelHits");
+  SetFileNameCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetCompressCmd = new G4UIcmdWithABool("/FP/hits/compress", this);
+  SetCompressCmd->SetGuidance("Compress the chunks with zlib");
+  SetCompressCmd->SetParameterName("compress", true);
+  SetCompressCmd->SetDefaultValue(true);
+  SetCompressCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetChunkSizeCmd = new G4UIcmdWithAnInteger("/FP/hits/chunkSize", this);
+  SetChunkSizeCmd->SetGuidance("Size of the chunks handed to the writer thread, in bytes");
+  SetChunkSizeCmd->SetParameterName("bytes", false);
+  SetChunkSizeCmd->SetRange("bytes > 0");
+  SetChunkSizeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPHitStreamMessenger::~FPHitStreamMessenger()
+{
+  delete SetEnableCmd;
+  delete SetFileNameCmd;
+  delete SetCompressCmd;
+  delete SetChunkSizeCmd;
+  delete hitsDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPHitStreamMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPStream->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetFileNameCmd ) {
+      FPStream->SetFileName(newValues);
+    }
+
+    if (command == SetCompressCmd ) {
+      FPStream->SetCompression(SetCompressCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetChunkSizeCmd ) {
+      FPStream->SetChunkSize(SetChunkSizeCmd->GetNewIntValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,148 @@
+/// October 19, 2026: Multi-threaded run manager with adaptive event batches.
+
+#include "FPMTRunManager.hh"
+#include "FPMTRunManagerMessenger.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4AutoLock.hh"
+
+#include <algorithm>
+#include <iomanip>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMTRunManager::FPMTRunManager()
+  : G4MTRunManager(),
+    fAdaptive(true),
+    fBatchTime(0.2),
+    fMaxBatch(0),
+    fReport(true),
+    fRunStart(Clock::now())
+{
+  fMessenger = new FPMTRunManagerMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMTRunManager::~FPMTRunManager()
+{
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMTRunManager::InitializeEventLoop(G4int n_event, const char* macroFile, G4int n_select)
+{
+  // Reset before the workers are released by the base class
+  {
+    G4AutoLock lock(&fMutex);
+    fThreads.assign(std::max(GetNumberOfThreads(), 1), ThreadLoad());
+    fEventCost.Reset();
+    fRunStart = Clock::now();
+  }
+  G4MTRunManager::InitializeEventLoop(n_event, macroFile, n_select);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPMTRunManager::SetUpNEvents(G4Event* evt, G4SeedsQueue* seedsQueue, G4bool reseedRequired)
+{
+  G4AutoLock lock(&fMutex);
+  Clock::time_point now = Clock::now();
+
+  // The batch the calling worker has just completed
+  G4int thread = G4Threading::G4GetThreadId();
+  ThreadLoad* load = (thread >= 0 && thread < (G4int) fThreads.size()) ? &fThreads[thread] : nullptr;
+  if (load && load->batchEvents > 0) {
+    G4double seconds = std::chrono::duration<G4double>(now - load->batchStart).count();
+    load->busy += seconds;
+    fEventCost.Fill(seconds/load->batchEvents);
+  }
+
+  if (fAdaptive) eventModulo = NextBatchSize();
+  G4int nEvents = G4MTRunManager::SetUpNEvents(evt, seedsQueue, reseedRequired);
+
+  if (load) {
+    load->started = true;
+    load->batchEvents = nEvents;
+    load->batchStart = now;
+    if (nEvents > 0) {
+      load->nEvents += nEvents;
+      load->nBatches++;
+    } else if (!load->finished) {
+      load->finished = true;
+      load->finish = now;
+    }
+  }
+  return nEvents;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPMTRunManager::NextBatchSize() const
+{
+  G4int nThreads = (G4int) fThreads.size();
+  G4int remaining = numberOfEventToBeProcessed - numberOfEventProcessed;
+  if (remaining <= 0) return 1;
+
+  // Single events until every thread has measured a batch
+  if (fEventCost.GetN() < nThreads || fEventCost.GetMean() <= 0.) return 1;
+
+  // Guided: never more than half of a fair share of the events left
+  G4int batch = std::max(1, remaining/(2*nThreads));
+
+  // About fBatchTime seconds, less when the cost is spread
+  G4double mean = fEventCost.GetMean();
+  G4double spread = fEventCost.GetRMS()/mean;
+  G4double byTime = fBatchTime/(mean*(1. + spread));
+  if (byTime < batch) batch = std::max(1, (G4int) byTime);
+
+  if (fMaxBatch > 0) batch = std::min(batch, fMaxBatch);
+  return batch;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMTRunManager::RunTermination()
+{
+  G4MTRunManager::RunTermination();
+  if (fReport) PrintLoad();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMTRunManager::PrintLoad() const
+{
+  if (fThreads.empty()) return;
+
+  // Threads soft-aborted by the run control never asked for their last batch
+  Clock::time_point now = Clock::now();
+  std::vector<Clock::time_point> finish;
+  for (const ThreadLoad& load : fThreads) {
+    finish.push_back(load.finished ? load.finish : now);
+  }
+  Clock::time_point first = *std::min_element(finish.begin(), finish.end());
+  Clock::time_point last = *std::max_element(finish.begin(), finish.end());
+  G4double wall = std::chrono::duration<G4double>(last - fRunStart).count();
+  if (wall <= 0.) return;
+
+  FPPrecisionGuard precisionGuard;
+  G4cout << G4endl << " Thread load (" << (fAdaptive ? "adaptive batches" : "fixed batches")
+	 << ", event cost " << std::setprecision(3) << fEventCost.GetMean()*1000. << " ms"
+	 << " RMS " << fEventCost.GetRMS()*1000. << " ms):" << G4endl
+	 << "   thread    events   batches   busy (s)   idle (s)" << G4endl;
+  G4double busy = 0.;
+  for (std::size_t i = 0; i < fThreads.size(); i++) {
+    const ThreadLoad& load = fThreads[i];
+    busy += load.busy;
+    G4cout << "   " << std::setw(6) << i << std::setw(10) << load.nEvents
+	   << std::setw(10) << load.nBatches << std::setprecision(4)
+	   << std::setw(11) << load.busy << std::setw(11) << wall - load.busy << G4endl;
+  }
+  G4cout << "   wall " << std::setprecision(4) << wall << " s, threads busy "
+	 << std::setprecision(3) << 100.*busy/(wall*fThreads.size()) << " %, tail "
+	 << std::chrono::duration<G4double>(last - first).count()
+	 << " s between the first and the last thread to finish" << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,93 @@
+/// October 19, 2026: Multi-threaded run manager messenger.
+///
+///    /FP/mt/adaptive  : size the event batches from the measured event cost
+///    /FP/mt/batchTime : target duration of a batch
+///    /FP/mt/maxBatch  : largest batch (0: no limit)
+///    /FP/mt/report    : print the load of each thread at the end of the run
+///
+///    The event batches are handed out by the master: the commands are not broadcast.
+
+#include "globals.hh"
+
+#include "FPMTRunManagerMessenger.hh"
+
+#include "FPMTRunManager.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4SystemOfUnits.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMTRunManagerMessenger::FPMTRunManagerMessenger(FPMTRunManager* FPRunMgr)
+:FPRunManager(FPRunMgr)
+{
+  mtDir = new G4UIdirectory("/FP/mt/");
+  mtDir->SetGuidance("Distribution of the events to the threads:");
+
+  SetAdaptiveCmd = new G4UIcmdWithABool("/FP/mt/adaptive", this);
+  SetAdaptiveCmd->SetGuidance("Size the event batches from the measured event cost and the");
+  SetAdaptiveCmd->SetGuidance("events left; false: fixed batches of /run/eventModulo.");
+  SetAdaptiveCmd->SetParameterName("enable", true);
+  SetAdaptiveCmd->SetDefaultValue(true);
+  SetAdaptiveCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetAdaptiveCmd->SetToBeBroadcasted(false);
+
+  SetBatchTimeCmd = new G4UIcmdWithADoubleAndUnit("/FP/mt/batchTime", this);
+  SetBatchTimeCmd->SetGuidance("Target duration of a batch of events");
+  SetBatchTimeCmd->SetParameterName("time", false);
+  SetBatchTimeCmd->SetRange("time > 0.");
+  SetBatchTimeCmd->SetUnitCategory("Time");
+  SetBatchTimeCmd->SetDefaultUnit("s");
+  SetBatchTimeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetBatchTimeCmd->SetToBeBroadcasted(false);
+
+  SetMaxBatchCmd = new G4UIcmdWithAnInteger("/FP/mt/maxBatch", this);
+  SetMaxBatchCmd->SetGuidance("Largest number of events in a batch (0: no limit)");
+  SetMaxBatchCmd->SetParameterName("nEvents", false);
+  SetMaxBatchCmd->SetRange("nEvents >= 0");
+  SetMaxBatchCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetMaxBatchCmd->SetToBeBroadcasted(false);
+
+  SetReportCmd = new G4UIcmdWithABool("/FP/mt/report", this);
+  SetReportCmd->SetGuidance("Print the events, busy and idle time of each thread at the end of the run");
+  SetReportCmd->SetParameterName("enable", true);
+  SetReportCmd->SetDefaultValue(true);
+  SetReportCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetReportCmd->SetToBeBroadcasted(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMTRunManagerMessenger::~FPMTRunManagerMessenger()
+{
+  delete SetAdaptiveCmd;
+  delete SetBatchTimeCmd;
+  delete SetMaxBatchCmd;
+  delete SetReportCmd;
+  delete mtDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMTRunManagerMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetAdaptiveCmd ) {
+      FPRunManager->SetAdaptive(SetAdaptiveCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetBatchTimeCmd ) {
+      FPRunManager->SetBatchTime(SetBatchTimeCmd->GetNewDoubleValue(newValues)/s);
+    }
+
+    if (command == SetMaxBatchCmd ) {
+      FPRunManager->SetMaxBatch(SetMaxBatchCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetReportCmd ) {
+      FPRunManager->SetReport(SetReportCmd->GetNewBoolValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
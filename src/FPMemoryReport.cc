@@ -0,0 +1,239 @@
+/// October 19, 2026: Memory footprint report, per thread and per subsystem.
+
+#include "FPMemoryReport.hh"
+#include "FPMemoryReportMessenger.hh"
+#include "FPStackingAction.hh"
+#include "FPTrackInformation.hh"
+#include "FPTrajectory.hh"
+#include "SiPMhit.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4AutoLock.hh"
+#include "G4EventManager.hh"
+#include "G4Track.hh"
+#include "G4DynamicParticle.hh"
+#include "G4TouchableHistory.hh"
+#include "G4TrajectoryPoint.hh"
+#include "G4RootAnalysisManager.hh"
+
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+G4ThreadLocal std::size_t FPMemoryReport::fgPeakHits = 0;
+
+namespace {
+
+  // Pools are created on first use: a thread that never needed one has none
+  template <class T>
+  std::size_t PoolBytes(const G4Allocator<T>* allocator)
+  {
+    return allocator ? allocator->GetAllocatedSize() : 0;
+  }
+
+  // Entries, sums of weights and of weighted x (and squares) of each bin,
+  // with the underflow and overflow bins
+  std::size_t HistogramBytes()
+  {
+    G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
+    std::size_t bytes = 0;
+    for (G4int id = 0; id < analysisManager->GetNofH1s(); id++) {
+      auto h1 = analysisManager->GetH1(id, false);
+      if (!h1) continue;
+      std::size_t nBins = h1->axis().bins() + 2;
+      bytes += sizeof(*h1) + nBins*(sizeof(unsigned int) + 2*sizeof(double)
+				    + 2*(sizeof(std::vector<double>) + sizeof(double)));
+    }
+    return bytes;
+  }
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMemoryReport* FPMemoryReport::Instance()
+{
+  // Created by the first run action (on the master) and kept for the whole job
+  static FPMemoryReport* instance = new FPMemoryReport();
+  return instance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMemoryReport::FPMemoryReport()
+  : fEnabled(false),
+    fFileName("memory.json"),
+    fInterval(0),
+    fEvents(0)
+{
+  fMessenger = new FPMemoryReportMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMemoryReport::~FPMemoryReport()
+{
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+long FPMemoryReport::GetCurrentRSS()
+{
+  // Second field of statm: resident pages
+  long pages = 0, resident = 0;
+  std::ifstream statm("/proc/self/statm");
+  if (!(statm >> pages >> resident)) return 0;
+  return resident*(sysconf(_SC_PAGESIZE)/1024);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+long FPMemoryReport::GetPeakRSS()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+  return usage.ru_maxrss;   // kB on Linux
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReport::BeginOfRun()
+{
+  G4AutoLock lock(&fMutex);
+  fRecords.clear();
+  fEvents = 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReport::BeginOfThreadRun()
+{
+  fgPeakHits = 0;
+  auto stacking = dynamic_cast<FPStackingAction*>(
+    G4EventManager::GetEventManager()->GetUserStackingAction());
+  if (stacking) stacking->ResetPeakStackedTracks();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReport::EndOfEvent(std::size_t nHits)
+{
+  if (nHits > fgPeakHits) fgPeakHits = nHits;
+  if (fInterval <= 0) return;
+
+  G4int nEvents = ++fEvents;
+  if (nEvents % fInterval == 0) {
+    G4cout << "Memory: " << nEvents << " events, RSS " << GetCurrentRSS()/1024
+	   << " MB (peak " << GetPeakRSS()/1024 << " MB)" << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReport::EndOfThreadRun(G4int nEvents)
+{
+  if (!fEnabled) return;
+
+  ThreadRecord record;
+  record.thread = G4Threading::G4GetThreadId();
+  record.nEvents = nEvents;
+  record.pools = {
+    { "G4Track",            PoolBytes(aTrackAllocator()) },
+    { "G4DynamicParticle",  PoolBytes(aDynamicParticleAllocator()) },
+    { "G4TouchableHistory", PoolBytes(aTouchableHistoryAllocator()) },
+    { "FPTrackInformation", PoolBytes(FPTrackInformationAllocator) },
+    { "FPTrajectory",       PoolBytes(FPTrajectoryAllocator) },
+    { "G4TrajectoryPoint",  PoolBytes(aTrajectoryPointAllocator()) },
+    { "SiPMHit",            PoolBytes(SiPMHitAllocator) }
+  };
+  auto stacking = dynamic_cast<const FPStackingAction*>(
+    G4EventManager::GetEventManager()->GetUserStackingAction());
+  if (stacking) {
+    record.peakUrgentTracks = stacking->GetPeakUrgentTracks();
+    record.peakWaitingTracks = stacking->GetPeakWaitingTracks();
+  }
+  record.peakHits = fgPeakHits;
+  record.histogramBytes = HistogramBytes();
+
+  G4AutoLock lock(&fMutex);
+  fRecords.push_back(record);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReport::EndOfRun(G4int runID)
+{
+  if (!fEnabled) return;
+
+  G4AutoLock lock(&fMutex);
+  std::vector<ThreadRecord> records = fRecords;
+  lock.unlock();
+  std::sort(records.begin(), records.end(),
+	    [](const ThreadRecord& a, const ThreadRecord& b) { return a.thread < b.thread; });
+
+  Print(records);
+  Write(runID, records);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReport::Print(const std::vector<ThreadRecord>& records) const
+{
+  FPPrecisionGuard precisionGuard;
+  G4cout << G4endl << " Memory: RSS " << GetCurrentRSS()/1024 << " MB, peak "
+	 << GetPeakRSS()/1024 << " MB" << G4endl;
+  for (const ThreadRecord& record : records) {
+    std::size_t total = record.histogramBytes;
+    for (const auto& pool : record.pools) total += pool.second;
+    G4cout << "   thread " << record.thread << ": " << record.nEvents << " events, "
+	   << std::setprecision(4) << total/1024. << " kB in pools and histograms" << G4endl
+	   << "     pools (kB)    :";
+    for (const auto& pool : record.pools) {
+      if (pool.second > 0) G4cout << " " << pool.first << " " << pool.second/1024.;
+    }
+    G4cout << G4endl
+	   << "     peak stacks   : " << record.peakUrgentTracks << " urgent, "
+	   << record.peakWaitingTracks << " waiting tracks" << G4endl
+	   << "     peak hits     : " << record.peakHits << " per event ("
+	   << record.peakHits*sizeof(SiPMHit)/1024. << " kB)" << G4endl
+	   << "     histograms    : " << record.histogramBytes/1024. << " kB" << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReport::Write(G4int runID, const std::vector<ThreadRecord>& records) const
+{
+  std::ofstream out(fFileName);
+  if (!out) {
+    G4ExceptionDescription msg;
+    msg << "Cannot write the memory report " << fFileName << ".";
+    G4Exception("FPMemoryReport::Write()", "FPMem001", JustWarning, msg);
+    return;
+  }
+
+  // All sizes in bytes, except the resident set sizes (kB, as the kernel reports them)
+  out << "{\n  \"run\": " << runID
+      << ",\n  \"rssKB\": " << GetCurrentRSS()
+      << ",\n  \"peakRssKB\": " << GetPeakRSS()
+      << ",\n  \"threads\": [";
+  for (std::size_t i = 0; i < records.size(); i++) {
+    const ThreadRecord& record = records[i];
+    out << (i ? "," : "") << "\n    { \"thread\": " << record.thread
+	<< ", \"events\": " << record.nEvents << ", \"pools\": {";
+    for (std::size_t j = 0; j < record.pools.size(); j++) {
+      out << (j ? ", " : " ") << "\"" << record.pools[j].first << "\": " << record.pools[j].second;
+    }
+    out << " }, \"peakUrgentTracks\": " << record.peakUrgentTracks
+	<< ", \"peakWaitingTracks\": " << record.peakWaitingTracks
+	<< ", \"peakHitsPerEvent\": " << record.peakHits
+	<< ", \"peakHitsBytes\": " << record.peakHits*sizeof(SiPMHit)
+	<< ", \"histogramBytes\": " << record.histogramBytes << " }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
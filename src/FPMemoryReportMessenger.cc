@@ -0,0 +1,76 @@
+/// October 19, 2026: Memory report messenger.
+///
+///    /FP/memory/report   : report the memory of each thread and subsystem at the end of each run
+///    /FP/memory/fileName : JSON file of the report
+///    /FP/memory/interval : print the resident set size every given number of events
+///
+///    The report is shared by all threads: the commands are not broadcast.
+
+#include "globals.hh"
+
+#include "FPMemoryReportMessenger.hh"
+
+#include "FPMemoryReport.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMemoryReportMessenger::FPMemoryReportMessenger(FPMemoryReport* FPMem)
+:FPMemory(FPMem)
+{
+  memoryDir = new G4UIdirectory("/FP/memory/");
+  memoryDir->SetGuidance("Memory footprint report:");
+
+  SetReportCmd = new G4UIcmdWithABool("/FP/memory/report", this);
+  SetReportCmd->SetGuidance("Report at the end of each run the allocator pools, peak stacks, hits");
+  SetReportCmd->SetGuidance("and histograms of each thread, and the resident set size (also as JSON).");
+  SetReportCmd->SetParameterName("enable", true);
+  SetReportCmd->SetDefaultValue(true);
+  SetReportCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetReportCmd->SetToBeBroadcasted(false);
+
+  SetFileNameCmd = new G4UIcmdWithAString("/FP/memory/fileName", this);
+  SetFileNameCmd->SetGuidance("JSON file of the memory report (rewritten at each run)");
+  SetFileNameCmd->SetParameterName("fileName", false);
+  SetFileNameCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetFileNameCmd->SetToBeBroadcasted(false);
+
+  SetIntervalCmd = new G4UIcmdWithAnInteger("/FP/memory/interval", this);
+  SetIntervalCmd->SetGuidance("Print the resident set size every given number of events (0: never)");
+  SetIntervalCmd->SetParameterName("nEvents", false);
+  SetIntervalCmd->SetRange("nEvents >= 0");
+  SetIntervalCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetIntervalCmd->SetToBeBroadcasted(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPMemoryReportMessenger::~FPMemoryReportMessenger()
+{
+  delete SetReportCmd;
+  delete SetFileNameCmd;
+  delete SetIntervalCmd;
+  delete memoryDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPMemoryReportMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetReportCmd ) {
+      FPMemory->SetEnabled(SetReportCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetFileNameCmd ) {
+      FPMemory->SetFileName(newValues);
+    }
+
+    if (command == SetIntervalCmd ) {
+      FPMemory->SetInterval(SetIntervalCmd->GetNewIntValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,261 @@
+/// October 19, 2026: Optical boundary process with a fast path for the
+///                   constant-index interfaces.
+
+#include "FPOpBoundaryProcess.hh"
+#include "FPOpticalControl.hh"
+
+#include "G4RunManager.hh"
+#include "G4Run.hh"
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalBorderSurface.hh"
+#include "G4LogicalSkinSurface.hh"
+#include "G4TransportationManager.hh"
+#include "G4Navigator.hh"
+#include "G4GeometryTolerance.hh"
+#include "G4PhysicalConstants.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <cmath>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpBoundaryProcess::FresnelTable::FresnelTable(G4double n1, G4double n2)
+  : fN1(n1), fN2(n2), fTransS(kBins + 1), fTransP(kBins + 1)
+{
+  for (G4int i = 0; i <= kBins; i++) {
+    Transmission(n1, n2, G4double(i)/kBins, fTransS[i], fTransP[i]);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpBoundaryProcess::FresnelTable::Transmission(G4double n1, G4double n2, G4double cost1,
+						     G4double& transS, G4double& transP)
+{
+  // As G4OpBoundaryProcess::DielectricDielectric(): s2/s1 for a unit amplitude
+  transS = transP = 0.;
+  G4double sint2 = std::sqrt(std::max(1. - cost1*cost1, 0.))*n1/n2;
+  if (sint2 >= 1. || cost1 <= 0.) return;
+
+  G4double cost2 = std::sqrt(1. - sint2*sint2);
+  G4double s1 = n1*cost1;
+  G4double s2 = n2*cost2;
+  transS = 4.*s1*s2/((s1 + s2)*(s1 + s2));
+  G4double d = n2*cost1 + n1*cost2;
+  transP = 4.*s1*s2/(d*d);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double FPOpBoundaryProcess::FresnelTable::GetTransmission(G4double cost1, G4double perp2) const
+{
+  G4double x = cost1*kBins;
+  G4int i = std::min(G4int(x), kBins - 1);
+  G4double w = x - i;
+  G4double transS = fTransS[i] + w*(fTransS[i + 1] - fTransS[i]);
+  G4double transP = fTransP[i] + w*(fTransP[i + 1] - fTransP[i]);
+  return perp2*transS + (1. - perp2)*transP;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpBoundaryProcess::Interface::Interface(G4double n1, G4double n2)
+  : table(n1, n2),
+    velocity(c_light/n2)           // group velocity of a constant index
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpBoundaryProcess::FPOpBoundaryProcess(const G4String& processName)
+  : G4OpBoundaryProcess(processName),
+    fFastPath(false),
+    fRunID(-1),
+    fNavigator(nullptr),
+    fUsedFast(false),
+    fFastStatus(Undefined)
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpBoundaryProcess::~FPOpBoundaryProcess()
+{
+  for (auto& pair : fIndexPairs) delete pair.second;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4OpBoundaryProcessStatus FPOpBoundaryProcess::GetStatus() const
+{
+  return fUsedFast ? fFastStatus : G4OpBoundaryProcess::GetStatus();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double FPOpBoundaryProcess::ConstantIndex(const G4Material* material)
+{
+  G4MaterialPropertiesTable* table = material->GetMaterialPropertiesTable();
+  G4MaterialPropertyVector* rindex = table ? table->GetProperty(kRINDEX) : nullptr;
+  if (!rindex || rindex->GetVectorLength() == 0) return 0.;
+  // GetMinValue()/GetMaxValue() are the first and last points only: a
+  // dispersion curve may come back to its first value, so test every point
+  for (std::size_t i = 1; i < rindex->GetVectorLength(); i++) {
+    if ((*rindex)[i] != (*rindex)[0]) return 0.;
+  }
+  return (*rindex)[0];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+const FPOpBoundaryProcess::Interface*
+FPOpBoundaryProcess::FindInterface(const G4VPhysicalVolume* pre, const G4VPhysicalVolume* post)
+{
+  auto key = std::make_pair(pre, post);
+  auto found = fInterfaces.find(key);
+  if (found != fInterfaces.end()) return found->second;
+
+  const Interface* interface = nullptr;
+  const G4LogicalVolume* preLV = pre->GetLogicalVolume();
+  const G4LogicalVolume* postLV = post->GetLogicalVolume();
+  const G4Material* material1 = preLV->GetMaterial();
+  const G4Material* material2 = postLV->GetMaterial();
+  G4double n1 = ConstantIndex(material1);
+  G4double n2 = ConstantIndex(material2);
+
+  // Polished dielectric-dielectric without a surface: the only case handled here
+  if (material1 != material2 && n1 > 0. && n2 > 0.
+      && !G4LogicalBorderSurface::GetSurface(pre, post)
+      && !G4LogicalSkinSurface::GetSurface(postLV)
+      && !G4LogicalSkinSurface::GetSurface(preLV)) {
+    Interface*& pair = fIndexPairs[std::make_pair(n1, n2)];
+    if (!pair) pair = new Interface(n1, n2);
+    interface = pair;
+  }
+  fInterfaces[key] = interface;
+  return interface;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4VParticleChange* FPOpBoundaryProcess::PostStepDoIt(const G4Track& track, const G4Step& step)
+{
+  fUsedFast = false;
+
+  // The geometry or the setting may have changed between runs
+  const G4Run* run = G4RunManager::GetRunManager()->GetCurrentRun();
+  G4int runID = run ? run->GetRunID() : -1;
+  if (runID != fRunID) {
+    fRunID = runID;
+    fInterfaces.clear();
+    fFastPath = FPOpticalControl::Instance()->IsFastBoundary();
+    fNavigator = G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking();
+  }
+
+  const G4StepPoint* preStepPoint = step.GetPreStepPoint();
+  const G4StepPoint* postStepPoint = step.GetPostStepPoint();
+  static const G4double tolerance = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+  if (!fFastPath || postStepPoint->GetStepStatus() != fGeomBoundary
+      || track.GetStepLength() <= tolerance || !postStepPoint->GetPhysicalVolume()) {
+    return G4OpBoundaryProcess::PostStepDoIt(track, step);
+  }
+
+  const Interface* interface =
+    FindInterface(preStepPoint->GetPhysicalVolume(), postStepPoint->GetPhysicalVolume());
+  if (!interface) return G4OpBoundaryProcess::PostStepDoIt(track, step);
+
+  // Normal pointing back into the first volume, as in G4OpBoundaryProcess
+  G4bool valid = false;
+  G4ThreeVector normal = fNavigator->GetGlobalExitNormal(postStepPoint->GetPosition(), &valid);
+  if (!valid || track.GetMomentumDirection()*normal <= 0.) {
+    return G4OpBoundaryProcess::PostStepDoIt(track, step);
+  }
+  return FastPostStepDoIt(track, step, *interface, -normal);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4VParticleChange* FPOpBoundaryProcess::FastPostStepDoIt(const G4Track& track, const G4Step& step,
+							 const Interface& interface,
+							 const G4ThreeVector& normal)
+{
+  aParticleChange.Initialize(track);
+  fUsedFast = true;
+
+  const G4ThreeVector& momentum = track.GetMomentumDirection();
+  const G4ThreeVector& polarization = track.GetPolarization();
+  G4double n1 = interface.table.GetN1();
+  G4double n2 = interface.table.GetN2();
+
+  G4double cost1 = -(momentum*normal);
+  G4double sint1 = (cost1 < 1.) ? std::sqrt(1. - cost1*cost1) : 0.;
+  G4double sint2 = sint1*n1/n2;
+
+  G4ThreeVector newMomentum;
+  G4ThreeVector newPolarization;
+
+  if (sint2 >= 1.) {
+    // Total internal reflection
+    fFastStatus = TotalInternalReflection;
+    newMomentum = momentum + (2.*cost1)*normal;
+    newPolarization = -polarization + (2.*(polarization*normal))*normal;
+  } else {
+    G4double cost2 = std::sqrt(1. - sint2*sint2);
+
+    // Decomposition of the polarization in the plane of incidence
+    G4ThreeVector transverse;
+    G4double e1Perp, e1Parl;
+    if (sint1 > 0.) {
+      transverse = momentum.cross(normal).unit();
+      e1Perp = polarization*transverse;
+      e1Parl = (polarization - e1Perp*transverse).mag();
+    } else {
+      transverse = polarization;
+      e1Perp = 0.;
+      e1Parl = 1.;
+    }
+
+    // Amplitudes of the transmitted wave
+    G4double s1 = n1*cost1;
+    G4double e2Perp = 2.*s1*e1Perp/(n1*cost1 + n2*cost2);
+    G4double e2Parl = 2.*s1*e1Parl/(n2*cost1 + n1*cost2);
+
+    G4double transmission = interface.table.GetTransmission(cost1, e1Perp*e1Perp);
+    if (G4UniformRand() >= transmission) {
+      fFastStatus = FresnelReflection;
+      newMomentum = momentum + (2.*cost1)*normal;
+      if (sint1 > 0.) {
+	e2Parl = n2*e2Parl/n1 - e1Parl;
+	e2Perp = e2Perp - e1Perp;
+	G4double e2Abs = std::sqrt(e2Perp*e2Perp + e2Parl*e2Parl);
+	G4ThreeVector parallel = newMomentum.cross(transverse).unit();
+	newPolarization = (e2Parl/e2Abs)*parallel + (e2Perp/e2Abs)*transverse;
+      } else {
+	newPolarization = (n2 > n1) ? -polarization : polarization;
+      }
+    } else {
+      fFastStatus = FresnelRefraction;
+      if (sint1 > 0.) {
+	G4double alpha = cost1 - cost2*(n2/n1);
+	newMomentum = (momentum + alpha*normal).unit();
+	G4double e2Abs = std::sqrt(e2Perp*e2Perp + e2Parl*e2Parl);
+	G4ThreeVector parallel = newMomentum.cross(transverse).unit();
+	newPolarization = (e2Parl/e2Abs)*parallel + (e2Perp/e2Abs)*transverse;
+      } else {
+	newMomentum = momentum;
+	newPolarization = polarization;
+      }
+      aParticleChange.ProposeVelocity(interface.velocity);
+    }
+  }
+
+  aParticleChange.ProposeMomentumDirection(newMomentum.unit());
+  aParticleChange.ProposePolarization(newPolarization.unit());
+  return G4VDiscreteProcess::PostStepDoIt(track, step);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,276 @@
+/// October 19, 2026: Runtime control of the optical physics.
+///                   Energy-loss-only mode.
+///                   Fast path of the boundary process.
+///                   Batched scintillation.
+///                   Optical property scans.
+
+#include "FPOpticalControl.hh"
+#include "FPOpticalControlMessenger.hh"
+#include "FPOpticalPropertyDB.hh"
+
+#include "G4OpticalParameters.hh"
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4ProcessTable.hh"
+#include "G4ProcessVector.hh"
+#include "G4VProcess.hh"
+#include "G4StateManager.hh"
+#include "G4UImanager.hh"
+
+#include <set>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalControl* FPOpticalControl::Instance()
+{
+  // Created in main() (on the master) and kept for the whole job
+  static FPOpticalControl* instance = new FPOpticalControl();
+  return instance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalControl::FPOpticalControl()
+  : fYieldFactor(1.),
+    fELossOnly(false),
+    fFastBoundary(false),
+    fBatchedScintillation(false),
+    fPropertyDB(nullptr),
+    fPropertyGeneration(0)
+{
+  fMessenger = new FPOpticalControlMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalControl::~FPOpticalControl()
+{
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::SetTrackSecondariesFirst(G4bool value)
+{
+  G4OpticalParameters* parameters = G4OpticalParameters::Instance();
+  parameters->SetScintTrackSecondariesFirst(value);
+  parameters->SetCerenkovTrackSecondariesFirst(value);
+  PhysicsModified();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::SetMaxPhotonsPerStep(G4int value)
+{
+  G4OpticalParameters::Instance()->SetCerenkovMaxPhotonsPerStep(value);
+  PhysicsModified();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::SetMaxBetaChange(G4double percent)
+{
+  G4OpticalParameters::Instance()->SetCerenkovMaxBetaChange(percent);
+  PhysicsModified();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::SetYieldFactor(G4double value)
+{
+  fYieldFactor = value;
+  // The yield is read at every step: no re-initialization needed
+  ApplyYieldFactor();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::SetProcessActivation(const G4String& process, G4bool active)
+{
+  G4OpticalParameters::Instance()->SetProcessActivation(process, active);
+
+  // Once built, a process is switched in the process tables of all threads
+  if (G4StateManager::GetStateManager()->GetCurrentState() != G4State_Idle) return;
+
+  G4String command = (active ? "/process/activate " : "/process/inactivate ") + process;
+  if (G4UImanager::GetUIpointer()->ApplyCommand(command) != 0) {
+    G4ExceptionDescription msg;
+    msg << "Optical process " << process << " cannot be "
+	<< (active ? "activated" : "inactivated") << " (not constructed?)." << G4endl
+	<< "Set its activation before /run/initialize.";
+    G4Exception("FPOpticalControl::SetProcessActivation()", "FPOpt001", JustWarning, msg);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::SetELossOnly(G4bool value)
+{
+  if (value == fELossOnly) return;
+  fELossOnly = value;
+
+  // Only the processes active now, so that leaving the mode gives back the
+  // configuration of the user
+  if (fELossOnly) {
+    fELossOnlyInactivated.clear();
+    for (const char* process : { "Scintillation", "Cerenkov", "OpWLS", "OpWLS2", "OpBoundary",
+				 "OpAbsorption", "OpRayleigh", "OpMieHG" }) {
+      if (!G4OpticalParameters::Instance()->GetProcessActivation(process)) continue;
+      SetProcessActivation(process, false);
+      fELossOnlyInactivated.push_back(process);
+    }
+  } else {
+    for (const G4String& process : fELossOnlyInactivated) SetProcessActivation(process, true);
+    fELossOnlyInactivated.clear();
+  }
+
+  // No photon reaches the SiPMs: no hits collection to create and clear per event
+  G4UImanager::GetUIpointer()->ApplyCommand(fELossOnly ? "/hits/inactivate /sipmSD"
+					    : "/hits/activate /sipmSD");
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::ApplyYieldFactor()
+{
+  for (G4Material* material : *G4Material::GetMaterialTable()) {
+    G4MaterialPropertiesTable* table = material->GetMaterialPropertiesTable();
+    if (!table || !table->ConstPropertyExists("SCINTILLATIONYIELD")) continue;
+
+    // The first value seen is the one of the property file
+    auto base = fBaseYields.find(table);
+    if (base == fBaseYields.end()) {
+      base = fBaseYields.emplace(table, table->GetConstProperty("SCINTILLATIONYIELD")).first;
+    }
+    table->AddConstProperty("SCINTILLATIONYIELD", fYieldFactor*base->second);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::SetProperty(const G4String& target, const G4String& key,
+				   G4double value, const G4String& unit)
+{
+  if (!CanModifyProperty(target, key)) return;
+  PropertyModified(fPropertyDB->SetProperty(target, key, value, unit), key);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::ScaleProperty(const G4String& target, const G4String& key, G4double factor)
+{
+  if (!CanModifyProperty(target, key)) return;
+  PropertyModified(fPropertyDB->ScaleProperty(target, key, factor), key);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::ResetProperties()
+{
+  if (!fPropertyDB) return;
+  fPropertyDB->ResetProperties();
+
+  // Every yield is back to its value in the file
+  fBaseYields.clear();
+  ApplyYieldFactor();
+  fPropertyGeneration++;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPOpticalControl::CanModifyProperty(const G4String& target, const G4String& key) const
+{
+  if (!fPropertyDB) {
+    G4Exception("FPOpticalControl::CanModifyProperty()", "FPOpt002", JustWarning,
+		"No optical property database: change properties after /run/initialize.");
+    return false;
+  }
+  if (key == "RINDEX") {
+    G4Exception("FPOpticalControl::CanModifyProperty()", "FPOpt003", JustWarning,
+		"RINDEX can not be changed between runs (Cerenkov tables built once): edit the property file.");
+    return false;
+  }
+  // The boundary process reads these from the optical surfaces only
+  if ((key == "REFLECTIVITY" || key == "EFFICIENCY") && target.substr(0, 8) != "surface:") {
+    G4ExceptionDescription msg;
+    msg << key << " of a material is not read by GEANT4, only that of an optical surface"
+	<< " (e.g. surface:WrappingSurface): " << target << " not changed.";
+    G4Exception("FPOpticalControl::CanModifyProperty()", "FPOpt004", JustWarning, msg);
+    return false;
+  }
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::PropertyModified(G4MaterialPropertiesTable* table, const G4String& key)
+{
+  if (!table) return;
+
+  // The yield factor applies on top of the new value
+  if (key == "SCINTILLATIONYIELD") {
+    fBaseYields.erase(table);
+    ApplyYieldFactor();
+  }
+  fPropertyGeneration++;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::UpdatePhysicsTables()
+{
+  static G4ThreadLocal G4int builtGeneration = 0;
+  G4int generation = GetPropertyGeneration();
+  if (generation == builtGeneration) return;
+  builtGeneration = generation;
+
+  // The processes that tabulate material spectra in BuildPhysicsTable, each
+  // instance once (the scintillation process is shared by the particles)
+  std::set<G4VProcess*> rebuilt;
+  G4ProcessTable* processTable = G4ProcessTable::GetProcessTable();
+  for (const char* name : { "Scintillation", "OpWLS", "OpWLS2", "OpRayleigh" }) {
+    G4ProcessVector* processes = processTable->FindProcesses(name);
+    for (std::size_t i = 0; i < processes->size(); i++) {
+      G4VProcess* process = (*processes)[i];
+      if (rebuilt.insert(process).second) process->BuildPhysicsTable(*G4OpticalPhoton::Definition());
+    }
+    delete processes;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::PhysicsModified() const
+{
+  if (G4StateManager::GetStateManager()->GetCurrentState() == G4State_Idle) {
+    G4UImanager::GetUIpointer()->ApplyCommand("/run/physicsModified");
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControl::Print() const
+{
+  const G4OpticalParameters* parameters = G4OpticalParameters::Instance();
+
+  G4cout << G4endl << " Optical physics:" << G4endl
+	 << "   track secondaries first : scintillation "
+	 << (parameters->GetScintTrackSecondariesFirst() ? "yes" : "no")
+	 << ", Cerenkov " << (parameters->GetCerenkovTrackSecondariesFirst() ? "yes" : "no") << G4endl
+	 << "   Cerenkov photons/step   : " << parameters->GetCerenkovMaxPhotonsPerStep() << G4endl
+	 << "   max beta change/step    : " << parameters->GetCerenkovMaxBetaChange() << " %" << G4endl
+	 << "   scintillation yield x   : " << fYieldFactor << G4endl
+	 << "   mode                    : " << (fELossOnly ? "eLoss only" : "full optics") << G4endl
+	 << "   fast boundary           : " << (fFastBoundary ? "yes" : "no") << G4endl
+	 << "   batched scintillation   : " << (fBatchedScintillation ? "yes" : "no") << G4endl
+	 << "   property changes        : " << GetPropertyGeneration() << G4endl
+	 << "   processes               :";
+  for (const char* process : { "Cerenkov", "Scintillation", "OpAbsorption", "OpRayleigh",
+			       "OpMieHG", "OpBoundary", "OpWLS", "OpWLS2" }) {
+    G4cout << " " << process << (parameters->GetProcessActivation(process) ? "" : "(off)");
+  }
+  G4cout << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
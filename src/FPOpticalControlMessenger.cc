@@ -0,0 +1,228 @@
+/// October 19, 2026: Optical physics control messenger.
+///
+///    /FP/optical/trackSecondariesFirst : track the optical photons of a step before its parent continues
+///    /FP/optical/maxPhotonsPerStep     : maximum number of Cerenkov photons per step
+///    /FP/optical/maxBetaChange         : maximum change of beta of the parent per step (percent)
+///    /FP/optical/yieldFactor           : factor on the scintillation yield of every material
+///    /FP/optical/activate              : activate or inactivate an optical process
+///    /FP/optical/eLossOnly             : energy-loss-only runs, without optical photons
+///    /FP/optical/fastBoundary          : tabulated Fresnel coefficients for the constant-index boundaries
+///    /FP/optical/batchedScintillation  : generate the scintillation photons of a step in one batch
+///    /FP/optical/setProperty           : set a property of the property file between runs
+///    /FP/optical/scaleProperty         : scale a property of the property file between runs
+///    /FP/optical/resetProperties       : back to the properties of the property file
+///    /FP/optical/print                 : print the current settings
+///
+///    G4OpticalParameters is shared by all threads: the commands are not broadcast.
+
+#include "globals.hh"
+
+#include "FPOpticalControlMessenger.hh"
+
+#include "FPOpticalControl.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithoutParameter.hh"
+#include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
+
+#include <sstream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalControlMessenger::FPOpticalControlMessenger(FPOpticalControl* FPOpt)
+:FPOptical(FPOpt)
+{
+  opticalDir = new G4UIdirectory("/FP/optical/");
+  opticalDir->SetGuidance("Optical physics tuning (throughput against fidelity):");
+
+  SetTrackSecondariesFirstCmd = new G4UIcmdWithABool("/FP/optical/trackSecondariesFirst", this);
+  SetTrackSecondariesFirstCmd->SetGuidance("Track the scintillation and Cerenkov photons of a step");
+  SetTrackSecondariesFirstCmd->SetGuidance("before the parent continues (keeps the stacks small).");
+  SetTrackSecondariesFirstCmd->SetParameterName("enable", true);
+  SetTrackSecondariesFirstCmd->SetDefaultValue(true);
+  SetTrackSecondariesFirstCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetTrackSecondariesFirstCmd->SetToBeBroadcasted(false);
+
+  SetMaxPhotonsPerStepCmd = new G4UIcmdWithAnInteger("/FP/optical/maxPhotonsPerStep", this);
+  SetMaxPhotonsPerStepCmd->SetGuidance("Maximum number of Cerenkov photons generated in one step");
+  SetMaxPhotonsPerStepCmd->SetGuidance("(the step of the parent is limited accordingly).");
+  SetMaxPhotonsPerStepCmd->SetParameterName("nPhotons", false);
+  SetMaxPhotonsPerStepCmd->SetRange("nPhotons > 0");
+  SetMaxPhotonsPerStepCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetMaxPhotonsPerStepCmd->SetToBeBroadcasted(false);
+
+  SetMaxBetaChangeCmd = new G4UIcmdWithADouble("/FP/optical/maxBetaChange", this);
+  SetMaxBetaChangeCmd->SetGuidance("Maximum change of beta of the parent in one step, in percent");
+  SetMaxBetaChangeCmd->SetParameterName("percent", false);
+  SetMaxBetaChangeCmd->SetRange("percent > 0.");
+  SetMaxBetaChangeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetMaxBetaChangeCmd->SetToBeBroadcasted(false);
+
+  SetYieldFactorCmd = new G4UIcmdWithADouble("/FP/optical/yieldFactor", this);
+  SetYieldFactorCmd->SetGuidance("Factor on the scintillation yield of every material");
+  SetYieldFactorCmd->SetGuidance("(SCINTILLATIONYIELD of the optical property file).");
+  SetYieldFactorCmd->SetParameterName("factor", false);
+  SetYieldFactorCmd->SetRange("factor >= 0.");
+  SetYieldFactorCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetYieldFactorCmd->SetToBeBroadcasted(false);
+
+  SetActivationCmd = new G4UIcommand("/FP/optical/activate", this);
+  SetActivationCmd->SetGuidance("Activate or inactivate an optical process");
+  G4UIparameter* process = new G4UIparameter("process", 's', false);
+  process->SetParameterCandidates("Cerenkov Scintillation OpAbsorption OpRayleigh OpMieHG OpBoundary OpWLS OpWLS2");
+  SetActivationCmd->SetParameter(process);
+  G4UIparameter* active = new G4UIparameter("active", 'b', true);
+  active->SetDefaultValue(true);
+  SetActivationCmd->SetParameter(active);
+  SetActivationCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetActivationCmd->SetToBeBroadcasted(false);
+
+  SetELossOnlyCmd = new G4UIcmdWithABool("/FP/optical/eLossOnly", this);
+  SetELossOnlyCmd->SetGuidance("Energy-loss-only runs (muon eLoss calibration): the optical processes");
+  SetELossOnlyCmd->SetGuidance("and the SiPM detector are switched off, only the eLoss is kept.");
+  SetELossOnlyCmd->SetGuidance("false: back to the full optical simulation. After /run/initialize.");
+  SetELossOnlyCmd->SetParameterName("enable", true);
+  SetELossOnlyCmd->SetDefaultValue(true);
+  SetELossOnlyCmd->AvailableForStates(G4State_Idle);
+  SetELossOnlyCmd->SetToBeBroadcasted(false);
+
+  SetFastBoundaryCmd = new G4UIcmdWithABool("/FP/optical/fastBoundary", this);
+  SetFastBoundaryCmd->SetGuidance("Fast path of the boundary process for the interfaces of constant");
+  SetFastBoundaryCmd->SetGuidance("indices without optical surface (tabulated Fresnel coefficients).");
+  SetFastBoundaryCmd->SetParameterName("enable", true);
+  SetFastBoundaryCmd->SetDefaultValue(true);
+  SetFastBoundaryCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetFastBoundaryCmd->SetToBeBroadcasted(false);
+
+  SetBatchedScintillationCmd = new G4UIcmdWithABool("/FP/optical/batchedScintillation", this);
+  SetBatchedScintillationCmd->SetGuidance("Sample the scintillation photons of a step in one batch");
+  SetBatchedScintillationCmd->SetGuidance("(materials with one emission component and no rise time).");
+  SetBatchedScintillationCmd->SetParameterName("enable", true);
+  SetBatchedScintillationCmd->SetDefaultValue(true);
+  SetBatchedScintillationCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetBatchedScintillationCmd->SetToBeBroadcasted(false);
+
+  SetPropertyCmd = new G4UIcommand("/FP/optical/setProperty", this);
+  SetPropertyCmd->SetGuidance("Set an optical property of the property file between runs,");
+  SetPropertyCmd->SetGuidance("e.g. EJ200 ABSLENGTH 2.5 m, surface:WrappingSurface REFLECTIVITY 0.9 -.");
+  SetPropertyCmd->SetGuidance("A spectrum becomes constant. Not RINDEX. REFLECTIVITY and EFFICIENCY");
+  SetPropertyCmd->SetGuidance("are read from optical surfaces only: a material value has no effect.");
+  SetPropertyCmd->SetParameter(new G4UIparameter("target", 's', false));
+  SetPropertyCmd->SetParameter(new G4UIparameter("key", 's', false));
+  SetPropertyCmd->SetParameter(new G4UIparameter("value", 'd', false));
+  G4UIparameter* unit = new G4UIparameter("unit", 's', true);
+  unit->SetDefaultValue("-");
+  SetPropertyCmd->SetParameter(unit);
+  SetPropertyCmd->AvailableForStates(G4State_Idle);
+  SetPropertyCmd->SetToBeBroadcasted(false);
+
+  ScalePropertyCmd = new G4UIcommand("/FP/optical/scaleProperty", this);
+  ScalePropertyCmd->SetGuidance("Scale an optical property of the property file between runs");
+  ScalePropertyCmd->SetGuidance("(factor on the value read from the file), e.g. WLS WLSABSLENGTH 0.5.");
+  ScalePropertyCmd->SetParameter(new G4UIparameter("target", 's', false));
+  ScalePropertyCmd->SetParameter(new G4UIparameter("key", 's', false));
+  G4UIparameter* factor = new G4UIparameter("factor", 'd', false);
+  factor->SetParameterRange("factor > 0.");
+  ScalePropertyCmd->SetParameter(factor);
+  ScalePropertyCmd->AvailableForStates(G4State_Idle);
+  ScalePropertyCmd->SetToBeBroadcasted(false);
+
+  ResetPropertiesCmd = new G4UIcmdWithoutParameter("/FP/optical/resetProperties", this);
+  ResetPropertiesCmd->SetGuidance("Back to the optical properties of the property file");
+  ResetPropertiesCmd->AvailableForStates(G4State_Idle);
+  ResetPropertiesCmd->SetToBeBroadcasted(false);
+
+  PrintCmd = new G4UIcmdWithoutParameter("/FP/optical/print", this);
+  PrintCmd->SetGuidance("Print the optical physics settings");
+  PrintCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  PrintCmd->SetToBeBroadcasted(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalControlMessenger::~FPOpticalControlMessenger()
+{
+  delete SetTrackSecondariesFirstCmd;
+  delete SetMaxPhotonsPerStepCmd;
+  delete SetMaxBetaChangeCmd;
+  delete SetYieldFactorCmd;
+  delete SetActivationCmd;
+  delete SetELossOnlyCmd;
+  delete SetFastBoundaryCmd;
+  delete SetBatchedScintillationCmd;
+  delete SetPropertyCmd;
+  delete ScalePropertyCmd;
+  delete ResetPropertiesCmd;
+  delete PrintCmd;
+  delete opticalDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalControlMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetTrackSecondariesFirstCmd ) {
+      FPOptical->SetTrackSecondariesFirst(SetTrackSecondariesFirstCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetMaxPhotonsPerStepCmd ) {
+      FPOptical->SetMaxPhotonsPerStep(SetMaxPhotonsPerStepCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetMaxBetaChangeCmd ) {
+      FPOptical->SetMaxBetaChange(SetMaxBetaChangeCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetYieldFactorCmd ) {
+      FPOptical->SetYieldFactor(SetYieldFactorCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetActivationCmd ) {
+      G4String process;
+      G4String active;
+      std::istringstream is(newValues);
+      is >> process >> active;
+      FPOptical->SetProcessActivation(process, G4UIcommand::ConvertToBool(active));
+    }
+
+    if (command == SetELossOnlyCmd ) {
+      FPOptical->SetELossOnly(SetELossOnlyCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetFastBoundaryCmd ) {
+      FPOptical->SetFastBoundary(SetFastBoundaryCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetBatchedScintillationCmd ) {
+      FPOptical->SetBatchedScintillation(SetBatchedScintillationCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetPropertyCmd ) {
+      G4String target, key, unit;
+      G4double value;
+      std::istringstream is(newValues);
+      is >> target >> key >> value >> unit;
+      FPOptical->SetProperty(target, key, value, unit);
+    }
+
+    if (command == ScalePropertyCmd ) {
+      G4String target, key;
+      G4double factor;
+      std::istringstream is(newValues);
+      is >> target >> key >> factor;
+      FPOptical->ScaleProperty(target, key, factor);
+    }
+
+    if (command == ResetPropertiesCmd ) {
+      FPOptical->ResetProperties();
+    }
+
+    if (command == PrintCmd ) {
+      FPOptical->Print();
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
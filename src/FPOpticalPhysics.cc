@@ -0,0 +1,92 @@
+/// October 19, 2026: Optical physics of the panel.
+/// October 19, 2026: Batched scintillation.
+
+#include "FPOpticalPhysics.hh"
+#include "FPOpBoundaryProcess.hh"
+#include "FPScintillation.hh"
+
+#include "G4OpticalPhoton.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalPhysics::FPOpticalPhysics()
+  : G4OpticalPhysics()
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalPhysics::~FPOpticalPhysics()
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPhysics::ConstructProcess()
+{
+  G4OpticalPhysics::ConstructProcess();
+  ReplaceBoundary();
+  ReplaceScintillation();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPhysics::ReplaceBoundary()
+{
+  // Not constructed if OpBoundary was inactivated before the initialization
+  G4ProcessManager* manager = G4OpticalPhoton::Definition()->GetProcessManager();
+  G4ProcessVector* processes = manager->GetProcessList();
+  for (std::size_t i = 0; i < processes->size(); i++) {
+    auto boundary = dynamic_cast<G4OpBoundaryProcess*>((*processes)[i]);
+    if (!boundary) continue;
+
+    G4bool active = manager->GetProcessActivation(boundary);
+    manager->RemoveProcess(boundary);
+    delete boundary;
+
+    FPOpBoundaryProcess* fastBoundary = new FPOpBoundaryProcess();
+    manager->AddDiscreteProcess(fastBoundary);
+    manager->SetProcessActivation(fastBoundary, active);
+    break;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPhysics::ReplaceScintillation()
+{
+  // One process shared by every particle it applies to, as G4OpticalPhysics does
+  G4Scintillation* stock = nullptr;
+  FPScintillation* batched = nullptr;
+
+  auto particleIterator = GetParticleIterator();
+  particleIterator->reset();
+  while ((*particleIterator)()) {
+    G4ProcessManager* manager = particleIterator->value()->GetProcessManager();
+    if (!manager) continue;
+
+    G4ProcessVector* processes = manager->GetProcessList();
+    for (std::size_t i = 0; i < processes->size(); i++) {
+      auto scintillation = dynamic_cast<G4Scintillation*>((*processes)[i]);
+      if (!scintillation || scintillation == batched) continue;
+
+      G4bool active = manager->GetProcessActivation(scintillation);
+      manager->RemoveProcess(scintillation);
+      stock = scintillation;
+
+      if (!batched) {
+	batched = new FPScintillation();
+	batched->AddSaturation(stock->GetSaturation());
+      }
+      manager->AddProcess(batched);
+      manager->SetProcessOrderingToLast(batched, idxAtRest);
+      manager->SetProcessOrderingToLast(batched, idxPostStep);
+      manager->SetProcessActivation(batched, active);
+      break;
+    }
+  }
+  delete stock;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,326 @@
+/// October 19, 2026: Optical property database.
+///
+///    See FPOpticalPropertyDB.hh for the file format.
+///                   Properties changed between runs.
+
+#include "FPOpticalPropertyDB.hh"
+
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4UnitsTable.hh"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalPropertyDB::FPOpticalPropertyDB()
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPOpticalPropertyDB::~FPOpticalPropertyDB()
+{
+  // The property vectors and surface tables are owned by the GEANT4 tables
+  // they were given to and live until the end of the job.
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPropertyDB::Load(const G4String& fileName)
+{
+  std::ifstream infile(fileName);
+  if (!infile) {
+    G4ExceptionDescription msg;
+    msg << "Can not open optical property file " << fileName;
+    G4Exception("FPOpticalPropertyDB::Load()", "FPOptical001", FatalException, msg);
+    return;
+  }
+
+  std::string line, logicalLine;
+  G4int lineNumber = 0, firstLine = 0;
+  while (std::getline(infile, line)) {
+    lineNumber++;
+    std::size_t comment = line.find('#');
+    if (comment != std::string::npos) line.erase(comment);
+
+    // Continuation lines
+    if (logicalLine.empty()) firstLine = lineNumber;
+    std::size_t last = line.find_last_not_of(" \t\r");
+    if (last != std::string::npos && line[last] == '\\') {
+      logicalLine += line.substr(0, last) + " ";
+      continue;
+    }
+    logicalLine += line;
+
+    std::vector<G4String> tokens;
+    std::istringstream ss(logicalLine);
+    std::string token;
+    while (ss >> token) tokens.push_back(token);
+    logicalLine.clear();
+    if (tokens.empty()) continue;
+
+    std::ostringstream where;
+    where << fileName << ":" << firstLine;
+
+    if (tokens[0] == "grid" && tokens.size() >= 4) {
+      std::vector<G4double> energies;
+      ParseValues(tokens, 3, ParseUnit(tokens[2], where.str()), energies, where.str());
+      fGrids[tokens[1]] = energies;
+    } else if (tokens[0] == "property" && tokens.size() >= 6) {
+      auto grid = fGrids.find(tokens[3]);
+      if (grid == fGrids.end()) {
+	G4ExceptionDescription msg;
+	msg << where.str() << ": unknown energy grid " << tokens[3];
+	G4Exception("FPOpticalPropertyDB::Load()", "FPOptical002", FatalException, msg);
+	return;
+      }
+      std::vector<G4double> values;
+      ParseValues(tokens, 5, ParseUnit(tokens[4], where.str()), values, where.str());
+      // A single value stands for a constant spectrum over the grid
+      if (values.size() == 1) values.resize(grid->second.size(), values[0]);
+      if (values.size() != grid->second.size()) {
+	G4ExceptionDescription msg;
+	msg << where.str() << ": " << values.size() << " values for a grid of "
+	    << grid->second.size() << " energies";
+	G4Exception("FPOpticalPropertyDB::Load()", "FPOptical003", FatalException, msg);
+	return;
+      }
+      Property property = { tokens[2], false, 0., MakeVector(grid->second, values) };
+      AddEntry(tokens[1], property);
+    } else if (tokens[0] == "const" && tokens.size() == 5) {
+      std::vector<G4double> values;
+      ParseValues(tokens, 4, ParseUnit(tokens[3], where.str()), values, where.str());
+      Property property = { tokens[2], true, values[0], nullptr };
+      AddEntry(tokens[1], property);
+    } else {
+      G4ExceptionDescription msg;
+      msg << where.str() << ": can not parse \"" << tokens[0] << " ...\"";
+      G4Exception("FPOpticalPropertyDB::Load()", "FPOptical004", FatalException, msg);
+      return;
+    }
+  }
+
+  fFileTargets = fTargets;
+
+  G4cout << "Optical properties read from " << fileName << ": "
+	 << fVectors.size() << " distinct property vectors" << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double FPOpticalPropertyDB::ParseUnit(const G4String& unit, const G4String& where) const
+{
+  if (unit == "-") return 1.0;
+
+  G4String symbol = unit;
+  G4bool inverse = false;
+  if (symbol.substr(0, 2) == "1/") {
+    symbol = symbol.substr(2);
+    inverse = true;
+  }
+  if (!G4UnitDefinition::IsUnitDefined(symbol)) {
+    G4ExceptionDescription msg;
+    msg << where << ": unknown unit " << unit;
+    G4Exception("FPOpticalPropertyDB::ParseUnit()", "FPOptical005", FatalException, msg);
+    return 1.0;
+  }
+  G4double value = G4UnitDefinition::GetValueOf(symbol);
+  return inverse ? 1.0/value : value;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPropertyDB::ParseValues(std::vector<G4String>& tokens, std::size_t first,
+				      G4double unit, std::vector<G4double>& values,
+				      const G4String& where) const
+{
+  for (std::size_t i = first; i < tokens.size(); i++) {
+    const G4String& token = tokens[i];
+    G4int repeat = 1;
+    std::size_t star = token.find('*');
+    try {
+      std::size_t used = 0;
+      if (star != std::string::npos) repeat = std::stoi(token.substr(0, star));
+      G4String number = (star != std::string::npos) ? token.substr(star+1) : token;
+      G4double value = std::stod(number, &used);
+      if (used != number.size() || repeat < 1) throw std::invalid_argument(token);
+      values.insert(values.end(), repeat, value*unit);
+    } catch (const std::exception&) {
+      G4ExceptionDescription msg;
+      msg << where << ": bad value " << token;
+      G4Exception("FPOpticalPropertyDB::ParseValues()", "FPOptical006", FatalException, msg);
+      return;
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4MaterialPropertyVector* FPOpticalPropertyDB::MakeVector(const std::vector<G4double>& energies,
+							  const std::vector<G4double>& values)
+{
+  std::vector<G4double> e = energies, v = values;
+
+  // Constant spectrum: two points spanning the grid are enough
+  G4bool constant = true;
+  for (auto value : values) constant = constant && (value == values[0]);
+  if (constant && energies.size() > 2) {
+    e = { energies.front(), energies.back() };
+    v = { values[0], values[0] };
+  }
+
+  // Identical tables are shared
+  std::vector<G4double> key = e;
+  key.insert(key.end(), v.begin(), v.end());
+  auto itr = fVectors.find(key);
+  if (itr != fVectors.end()) return itr->second;
+
+  auto vector = new G4MaterialPropertyVector(e, v);
+  fVectors[key] = vector;
+  return vector;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPropertyDB::AddEntry(const G4String& target, const Property& property)
+{
+  std::vector<Property>& properties = fTargets[target];
+  for (auto& existing : properties) {
+    if (existing.key == property.key) {
+      existing = property;
+      return;
+    }
+  }
+  properties.push_back(property);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPropertyDB::Fill(G4MaterialPropertiesTable* table,
+			       const std::vector<Property>& properties) const
+{
+  for (const auto& property : properties) {
+    if (property.isConst) table->AddConstProperty(property.key, property.value);
+    else table->AddProperty(property.key, property.vector);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPropertyDB::ApplyToMaterials()
+{
+  for (const auto& target : fTargets) {
+    if (target.first.substr(0, 8) == "surface:") continue;
+
+    G4Material* material = G4Material::GetMaterial(target.first, false);
+    if (!material) {
+      G4ExceptionDescription msg;
+      msg << "Optical properties given for unknown material " << target.first;
+      G4Exception("FPOpticalPropertyDB::ApplyToMaterials()", "FPOptical007", JustWarning, msg);
+      continue;
+    }
+
+    G4MaterialPropertiesTable* table = material->GetMaterialPropertiesTable();
+    if (!table) {
+      table = new G4MaterialPropertiesTable();
+      material->SetMaterialPropertiesTable(table);
+    }
+    Fill(table, target.second);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4MaterialPropertiesTable* FPOpticalPropertyDB::GetSurfaceTable(const G4String& surfaceName)
+{
+  auto table = fSurfaceTables.find(surfaceName);
+  if (table != fSurfaceTables.end()) return table->second;
+
+  auto target = fTargets.find("surface:" + surfaceName);
+  if (target == fTargets.end()) return nullptr;
+
+  auto newTable = new G4MaterialPropertiesTable();
+  Fill(newTable, target->second);
+  fSurfaceTables[surfaceName] = newTable;
+  return newTable;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4MaterialPropertiesTable* FPOpticalPropertyDB::SetProperty(const G4String& target,
+							    const G4String& key,
+							    G4double value, const G4String& unit)
+{
+  return Modify(target, key, value*ParseUnit(unit, "/FP/optical/setProperty"), false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4MaterialPropertiesTable* FPOpticalPropertyDB::ScaleProperty(const G4String& target,
+							      const G4String& key, G4double factor)
+{
+  return Modify(target, key, factor, true);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4MaterialPropertiesTable* FPOpticalPropertyDB::Modify(const G4String& target, const G4String& key,
+						       G4double value, G4bool scale)
+{
+  // Always from the file, so that the steps of a scan do not accumulate
+  const Property* original = nullptr;
+  auto entry = fFileTargets.find(target);
+  if (entry != fFileTargets.end()) {
+    for (const auto& property : entry->second) {
+      if (property.key == key) original = &property;
+    }
+  }
+
+  // Only the tables handed out to GEANT4
+  G4MaterialPropertiesTable* table = nullptr;
+  if (target.substr(0, 8) == "surface:") {
+    auto surface = fSurfaceTables.find(target.substr(8));
+    if (surface != fSurfaceTables.end()) table = surface->second;
+  } else {
+    G4Material* material = G4Material::GetMaterial(target, false);
+    if (material) table = material->GetMaterialPropertiesTable();
+  }
+
+  if (!original || !table) {
+    G4ExceptionDescription msg;
+    msg << "No optical property " << key << " for " << target << " in the property files";
+    G4Exception("FPOpticalPropertyDB::Modify()", "FPOptical008", JustWarning, msg);
+    return nullptr;
+  }
+
+  Property property = *original;
+  if (property.isConst) {
+    property.value = scale ? value*original->value : value;
+  } else {
+    // A new vector: the original may be shared with other materials
+    std::vector<G4double> energies, values;
+    for (std::size_t i = 0; i < original->vector->GetVectorLength(); i++) {
+      energies.push_back(original->vector->Energy(i));
+      values.push_back(scale ? value*(*original->vector)[i] : value);
+    }
+    property.vector = MakeVector(energies, values);
+  }
+  AddEntry(target, property);
+  Fill(table, { property });
+  return table;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPOpticalPropertyDB::ResetProperties()
+{
+  fTargets = fFileTargets;
+  ApplyToMaterials();
+  for (const auto& surface : fSurfaceTables) {
+    Fill(surface.second, fTargets["surface:" + surface.first]);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,247 @@
+/// October 19, 2026: Fate accounting of the optical photons.
+
+#include "FPPhotonFates.hh"
+#include "FPPhotonFatesMessenger.hh"
+#include "FPTrackInformation.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4Track.hh"
+#include "G4Step.hh"
+#include "G4VProcess.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessTable.hh"
+#include "G4OpBoundaryProcess.hh"
+#include "G4OpticalPhoton.hh"
+
+#include <iomanip>
+#include <istream>
+#include <ostream>
+
+G4ThreadLocal FPPhotonFates* FPPhotonFates::fgInstance = nullptr;
+
+namespace {
+
+  const char* fateNames[FPPhotonFates::kNFates] =
+    { "detected", "absorbed panel", "absorbed epoxy", "absorbed cladding",
+      "absorbed fiber", "WLS converted", "lost wrapping", "WLS not trapped",
+      "escaped", "killed", "other" };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonFates::FPPhotonFates()
+  : G4VAccumulable("PhotonFates"),
+    fEnabled(false),
+    fPrintEvents(false),
+    fProcessesResolved(false),
+    fAbsorption(nullptr),
+    fWLS(nullptr),
+    fBoundary(nullptr)
+{
+  Reset();
+  BeginOfEvent();
+  fgInstance = this;
+  fMessenger = new FPPhotonFatesMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonFates::~FPPhotonFates()
+{
+  if (fgInstance == this) fgInstance = nullptr;
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+const char* FPPhotonFates::GetFateName(G4int fate)
+{
+  return fateNames[fate];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::Merge(const G4VAccumulable& other)
+{
+  const FPPhotonFates& fates = static_cast<const FPPhotonFates&>(other);
+  for (G4int fate = 0; fate < kNFates; fate++) {
+    fRunCounts[fate] += fates.fRunCounts[fate];
+    fRunSteps[fate]  += fates.fRunSteps[fate];
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::Reset()
+{
+  for (G4int fate = 0; fate < kNFates; fate++) {
+    fRunCounts[fate] = 0;
+    fRunSteps[fate] = 0;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::BeginOfRun()
+{
+  if (fEnabled) fComponents.Build();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::BeginOfEvent()
+{
+  for (G4int fate = 0; fate < kNFates; fate++) {
+    fEventCounts[fate] = 0;
+    fEventSteps[fate] = 0;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::EndOfEvent(G4int eventID)
+{
+  if (!fEnabled) return;
+
+  for (G4int fate = 0; fate < kNFates; fate++) {
+    fRunCounts[fate] += fEventCounts[fate];
+    fRunSteps[fate]  += fEventSteps[fate];
+  }
+
+  if (fPrintEvents) {
+    G4cout << "Photon fates of event " << eventID << ":";
+    for (G4int fate = 0; fate < kNFates; fate++) {
+      if (fEventCounts[fate] > 0) G4cout << "  " << fateNames[fate] << " " << fEventCounts[fate];
+    }
+    G4cout << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::ResolveProcesses()
+{
+  const G4ParticleDefinition* opticalPhoton = G4OpticalPhoton::Definition();
+  G4ProcessTable* processTable = G4ProcessTable::GetProcessTable();
+  fAbsorption = processTable->FindProcess("OpAbsorption", opticalPhoton);
+  fWLS = processTable->FindProcess("OpWLS", opticalPhoton);
+
+  G4ProcessVector* processes = opticalPhoton->GetProcessManager()->GetProcessList();
+  for (std::size_t i = 0; i < processes->size(); i++) {
+    fBoundary = dynamic_cast<G4OpBoundaryProcess*>((*processes)[i]);
+    if (fBoundary) break;
+  }
+  fProcessesResolved = true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::Classify(const G4Track* track)
+{
+  auto info = static_cast<const FPTrackInformation*>(track->GetUserInformation());
+  if (!info) return;
+  if (!fProcessesResolved) ResolveProcesses();
+
+  G4int fate = info->GetFate();
+  if (fate < 0) fate = ClassifyLastStep(track);
+
+  // A WLS photon not detected nor absorbed in the fiber was not trapped
+  if (fate != kDetected && fate != kAbsorbedFiber && fate != kWLSConverted
+      && fate != kKilled && fWLS && track->GetCreatorProcess() == fWLS) {
+    fate = kWLSNotTrapped;
+  }
+
+  fEventCounts[fate]++;
+  fEventSteps[fate] += track->GetCurrentStepNumber();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPPhotonFates::ClassifyLastStep(const G4Track* track) const
+{
+  const G4Step* step = track->GetStep();
+  const G4StepPoint* postStepPoint = step->GetPostStepPoint();
+  if (!postStepPoint->GetPhysicalVolume()) return kEscaped;
+
+  const G4VProcess* process = postStepPoint->GetProcessDefinedStep();
+  if (!process) return kOther;
+
+  // Bulk absorption, including the kill by the fiber fast simulation model
+  if (process == fAbsorption || process->GetProcessType() == fParameterisation) {
+    G4int component =
+      fComponents.Get(step->GetPreStepPoint()->GetPhysicalVolume()->GetLogicalVolume());
+    switch (component) {
+    case FPVolumeComponents::kPanel:    return kAbsorbedPanel;
+    case FPVolumeComponents::kEpoxy:    return kAbsorbedEpoxy;
+    case FPVolumeComponents::kCladding: return kAbsorbedCladding;
+    case FPVolumeComponents::kFiber:    return kAbsorbedFiber;
+    default:                            return kOther;
+    }
+  }
+
+  if (process == fWLS) return kWLSConverted;
+
+  if (fBoundary && process == fBoundary) {
+    G4OpBoundaryProcessStatus status = fBoundary->GetStatus();
+    if ((status == Absorption || status == Detection)
+	&& fComponents.Get(postStepPoint->GetPhysicalVolume()->GetLogicalVolume())
+	   == FPVolumeComponents::kWrapping) {
+      return kLostWrapping;
+    }
+  }
+
+  return kOther;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::Print() const
+{
+  if (!fEnabled) return;
+
+  G4long totalCounts = 0, totalSteps = 0;
+  for (G4int fate = 0; fate < kNFates; fate++) {
+    totalCounts += fRunCounts[fate];
+    totalSteps  += fRunSteps[fate];
+  }
+  if (totalCounts == 0) return;
+
+  FPPrecisionGuard precisionGuard;
+  G4cout << G4endl << " Optical photon fates:" << G4endl
+	 << "   " << std::setw(18) << "fate" << std::setw(14) << "photons" << std::setw(10) << "%"
+	 << std::setw(16) << "steps" << std::setw(10) << "% steps" << G4endl;
+  for (G4int fate = 0; fate < kNFates; fate++) {
+    G4cout << "   " << std::setw(18) << fateNames[fate]
+	   << std::setw(14) << fRunCounts[fate]
+	   << std::setw(10) << std::setprecision(3) << 100.*fRunCounts[fate]/totalCounts
+	   << std::setw(16) << fRunSteps[fate]
+	   << std::setw(10) << std::setprecision(3)
+	   << (totalSteps > 0 ? 100.*fRunSteps[fate]/totalSteps : 0.) << G4endl;
+  }
+  G4cout << "   " << std::setw(18) << "total" << std::setw(14) << totalCounts
+	 << std::setw(10) << "" << std::setw(16) << totalSteps << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::Save(std::ostream& out) const
+{
+  out.write(reinterpret_cast<const char*>(fRunCounts), sizeof(fRunCounts));
+  out.write(reinterpret_cast<const char*>(fRunSteps), sizeof(fRunSteps));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFates::Restore(std::istream& in)
+{
+  G4long counts[kNFates], steps[kNFates];
+  if (!in.read(reinterpret_cast<char*>(counts), sizeof(counts))
+      || !in.read(reinterpret_cast<char*>(steps), sizeof(steps))) return;
+  for (G4int fate = 0; fate < kNFates; fate++) {
+    fRunCounts[fate] += counts[fate];
+    fRunSteps[fate]  += steps[fate];
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
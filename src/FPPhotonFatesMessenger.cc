@@ -0,0 +1,58 @@
+/// October 19, 2026: Photon fates messenger.
+///
+///    /FP/fates/enable      : classify the optical photons at the end of their track
+///    /FP/fates/printEvents : print the fates of each event
+
+#include "globals.hh"
+
+#include "FPPhotonFatesMessenger.hh"
+
+#include "FPPhotonFates.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonFatesMessenger::FPPhotonFatesMessenger(FPPhotonFates* FPFate)
+:FPFates(FPFate)
+{
+  fatesDir = new G4UIdirectory("/FP/fates/");
+  fatesDir->SetGuidance("Optical photon fate accounting:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/fates/enable", this);
+  SetEnableCmd->SetGuidance("Classify the optical photons at the end of their track");
+  SetEnableCmd->SetGuidance("(detected, absorbed, lost at the wrapping, escaped, ...)");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetPrintEventsCmd = new G4UIcmdWithABool("/FP/fates/printEvents", this);
+  SetPrintEventsCmd->SetGuidance("Print the photon fates of each event");
+  SetPrintEventsCmd->SetParameterName("print", true);
+  SetPrintEventsCmd->SetDefaultValue(true);
+  SetPrintEventsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonFatesMessenger::~FPPhotonFatesMessenger()
+{
+  delete SetEnableCmd;
+  delete SetPrintEventsCmd;
+  delete fatesDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonFatesMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPFates->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetPrintEventsCmd ) {
+      FPFates->SetPrintEvents(SetPrintEventsCmd->GetNewBoolValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,235 @@
+/// October 19, 2026: Bounce and path length limiter of the optical photons.
+
+#include "FPPhotonLimiter.hh"
+#include "FPPhotonLimiterMessenger.hh"
+#include "FPStepConsumer.hh"
+#include "FPTrackInformation.hh"
+#include "FPPhotonFates.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4OpBoundaryProcess.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4ProcessManager.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
+#include "G4UnitsTable.hh"
+#include "Randomize.hh"
+
+#include <istream>
+#include <ostream>
+
+G4ThreadLocal FPPhotonLimiter* FPPhotonLimiter::fgInstance = nullptr;
+
+namespace {
+
+  // Count the reflections and the path length of the optical photons, then apply the limits
+  class FPPhotonLimiterConsumer : public FPStepConsumer
+  {
+  public:
+    FPPhotonLimiterConsumer(FPPhotonLimiter* limiter)
+      : FPStepConsumer(true, false, false), fLimiter(limiter),
+	fBoundary(nullptr), fBoundaryResolved(false) {}
+
+    virtual G4bool IsActive() const { return fLimiter->IsEnabled(); }
+
+    virtual void ProcessStep(const G4Step* step, const G4LogicalVolume*)
+    {
+      G4Track* track = step->GetTrack();
+      auto info = static_cast<FPTrackInformation*>(track->GetUserInformation());
+      if (!info || track->GetTrackStatus() != fAlive) return;
+
+      info->AddPathLength(step->GetStepLength());
+      if (step->GetPostStepPoint()->GetStepStatus() == fGeomBoundary) {
+	if (!fBoundaryResolved) ResolveBoundary();
+	if (fBoundary && IsReflection(fBoundary->GetStatus())) info->AddBounce();
+      }
+      fLimiter->Check(track, info);
+    }
+
+  private:
+    void ResolveBoundary()
+    {
+      G4ProcessVector* processes = G4OpticalPhoton::Definition()->GetProcessManager()->GetProcessList();
+      for (std::size_t i = 0; i < processes->size(); i++) {
+	fBoundary = dynamic_cast<G4OpBoundaryProcess*>((*processes)[i]);
+	if (fBoundary) break;
+      }
+      fBoundaryResolved = true;
+    }
+
+    static G4bool IsReflection(G4OpBoundaryProcessStatus status)
+    {
+      return status == FresnelReflection || status == TotalInternalReflection
+	|| status == LambertianReflection || status == LobeReflection
+	|| status == SpikeReflection || status == BackScattering;
+    }
+
+    FPPhotonLimiter*     fLimiter;
+    G4OpBoundaryProcess* fBoundary;
+    G4bool               fBoundaryResolved;
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonLimiter::FPPhotonLimiter()
+  : G4VAccumulable("PhotonLimiter"),
+    fEnabled(false),
+    fMaxBounces(1000),
+    fMaxPathLength(0.),
+    fMode(kKill),
+    fSurvival(0.1),
+    fRunMode(kKill)
+{
+  Reset();
+  fgInstance = this;
+  fMessenger = new FPPhotonLimiterMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonLimiter::~FPPhotonLimiter()
+{
+  if (fgInstance == this) fgInstance = nullptr;
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiter::BeginOfRun(G4bool unweightedReadout)
+{
+  fRunMode = fMode;
+  if (!fEnabled || fMode != kRoulette || !unweightedReadout) return;
+
+  // A survivor of weight 1/p would count as one photon: the trigger rate
+  // and the digitized spectra would be those of the cut photons
+  fRunMode = kKill;
+  if (G4Threading::IsMasterThread()) {
+    G4Exception("FPPhotonLimiter::BeginOfRun()", "FPLimiter002", JustWarning,
+		"Roulette not applied: the coincidence trigger or the SiPM digitizer counts "
+		"the hits, not their weights. The photons over the limits are killed.");
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPStepConsumer* FPPhotonLimiter::CreateStepConsumer()
+{
+  return new FPPhotonLimiterConsumer(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiter::Merge(const G4VAccumulable& other)
+{
+  const FPPhotonLimiter& limiter = static_cast<const FPPhotonLimiter&>(other);
+  fNKilled          += limiter.fNKilled;
+  fKilledBounces    += limiter.fKilledBounces;
+  fKilledPathLength += limiter.fKilledPathLength;
+  fNSurvived        += limiter.fNSurvived;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiter::Reset()
+{
+  fNKilled = 0;
+  fKilledBounces = 0;
+  fKilledPathLength = 0.;
+  fNSurvived = 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiter::Check(G4Track* track, FPTrackInformation* info)
+{
+  // A roulette survivor is played again at the next multiple of the limits
+  G4int level = info->GetRouletteLevel() + 1;
+  G4bool over = (fMaxBounces > 0 && info->GetBounces() >= level*fMaxBounces)
+    || (fMaxPathLength > 0. && info->GetPathLength() >= level*fMaxPathLength);
+  if (!over) return;
+
+  if (fRunMode == kRoulette && G4UniformRand() < fSurvival) {
+    info->SetRouletteLevel(level);
+    track->SetWeight(track->GetWeight()/fSurvival);
+    fNSurvived++;
+    return;
+  }
+
+  track->SetTrackStatus(fStopAndKill);
+  info->SetFate(FPPhotonFates::kKilled);
+  fNKilled++;
+  fKilledBounces += info->GetBounces();
+  fKilledPathLength += info->GetPathLength();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiter::Print() const
+{
+  if (!fEnabled) return;
+
+  G4cout << G4endl << " Photon limiter (" << (fRunMode == kRoulette ? "roulette" : "kill");
+  if (fMaxBounces > 0) G4cout << ", " << fMaxBounces << " bounces";
+  if (fMaxPathLength > 0.) G4cout << ", " << G4BestUnit(fMaxPathLength, "Length");
+  G4cout << "):" << G4endl
+	 << "   photons cut  : " << fNKilled << ", with " << fKilledBounces << " bounces and "
+	 << G4BestUnit(fKilledPathLength, "Length") << " of path" << G4endl;
+  if (fRunMode == kRoulette) {
+    FPPrecisionGuard precisionGuard(4);
+    G4cout << "   survivors    : " << fNSurvived << " (weight x "
+	   << 1./fSurvival << " per survival)" << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiter::Save(std::ostream& out) const
+{
+  out.write(reinterpret_cast<const char*>(&fMaxBounces), sizeof(fMaxBounces));
+  out.write(reinterpret_cast<const char*>(&fMaxPathLength), sizeof(fMaxPathLength));
+  out.write(reinterpret_cast<const char*>(&fRunMode), sizeof(fRunMode));
+  out.write(reinterpret_cast<const char*>(&fSurvival), sizeof(fSurvival));
+  out.write(reinterpret_cast<const char*>(&fNKilled), sizeof(fNKilled));
+  out.write(reinterpret_cast<const char*>(&fKilledBounces), sizeof(fKilledBounces));
+  out.write(reinterpret_cast<const char*>(&fKilledPathLength), sizeof(fKilledPathLength));
+  out.write(reinterpret_cast<const char*>(&fNSurvived), sizeof(fNSurvived));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiter::Restore(std::istream& in, G4bool takeSettings)
+{
+  G4int maxBounces, mode;
+  G4double maxPathLength, survival;
+  G4long nKilled, killedBounces, nSurvived;
+  G4double killedPathLength;
+  if (!in.read(reinterpret_cast<char*>(&maxBounces), sizeof(maxBounces))
+      || !in.read(reinterpret_cast<char*>(&maxPathLength), sizeof(maxPathLength))
+      || !in.read(reinterpret_cast<char*>(&mode), sizeof(mode))
+      || !in.read(reinterpret_cast<char*>(&survival), sizeof(survival))
+      || !in.read(reinterpret_cast<char*>(&nKilled), sizeof(nKilled))
+      || !in.read(reinterpret_cast<char*>(&killedBounces), sizeof(killedBounces))
+      || !in.read(reinterpret_cast<char*>(&killedPathLength), sizeof(killedPathLength))
+      || !in.read(reinterpret_cast<char*>(&nSurvived), sizeof(nSurvived))) return;
+  if (takeSettings) {
+    fMaxBounces    = maxBounces;
+    fMaxPathLength = maxPathLength;
+    fMode = fRunMode = mode;
+    fSurvival      = survival;
+  } else if (maxBounces != fMaxBounces || maxPathLength != fMaxPathLength
+	     || mode != fRunMode || survival != fSurvival) {
+    // Workers and master use the limits of the macro: the counts are added as they are
+    G4Exception("FPPhotonLimiter::Restore()", "FPLimiter001", JustWarning,
+		"Checkpoint counts of other photon limiter settings than the current ones");
+  }
+  fNKilled          += nKilled;
+  fKilledBounces    += killedBounces;
+  fKilledPathLength += killedPathLength;
+  fNSurvived        += nSurvived;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
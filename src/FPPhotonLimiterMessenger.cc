@@ -0,0 +1,103 @@
+/// October 19, 2026: Photon limiter messenger.
+///
+///    /FP/limit/enable        : apply the bounce and path length limits to the optical photons
+///    /FP/limit/maxBounces    : reflections before a photon is cut (0: no limit)
+///    /FP/limit/maxPathLength : path length before a photon is cut (0: no limit)
+///    /FP/limit/mode          : kill, or roulette with weight compensation
+///    /FP/limit/survival      : survival probability of the roulette
+
+#include "globals.hh"
+
+#include "FPPhotonLimiterMessenger.hh"
+
+#include "FPPhotonLimiter.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonLimiterMessenger::FPPhotonLimiterMessenger(FPPhotonLimiter* FPLim)
+:FPLimiter(FPLim)
+{
+  limitDir = new G4UIdirectory("/FP/limit/");
+  limitDir->SetGuidance("Bounce and path length limits of the optical photons:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/limit/enable", this);
+  SetEnableCmd->SetGuidance("Count the reflections and path length of the optical photons");
+  SetEnableCmd->SetGuidance("and cut those past the limits");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetMaxBouncesCmd = new G4UIcmdWithAnInteger("/FP/limit/maxBounces", this);
+  SetMaxBouncesCmd->SetGuidance("Reflections before a photon is cut (0: no limit)");
+  SetMaxBouncesCmd->SetParameterName("n", false);
+  SetMaxBouncesCmd->SetRange("n >= 0");
+  SetMaxBouncesCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetMaxPathLengthCmd = new G4UIcmdWithADoubleAndUnit("/FP/limit/maxPathLength", this);
+  SetMaxPathLengthCmd->SetGuidance("Path length before a photon is cut (0: no limit)");
+  SetMaxPathLengthCmd->SetParameterName("length", false);
+  SetMaxPathLengthCmd->SetRange("length >= 0.");
+  SetMaxPathLengthCmd->SetUnitCategory("Length");
+  SetMaxPathLengthCmd->SetDefaultUnit("m");
+  SetMaxPathLengthCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetModeCmd = new G4UIcmdWithAString("/FP/limit/mode", this);
+  SetModeCmd->SetGuidance("kill: kill the photons past a limit");
+  SetModeCmd->SetGuidance("roulette: kill them with probability 1 - survival, the survivors");
+  SetModeCmd->SetGuidance("          having their weight divided by the survival probability");
+  SetModeCmd->SetParameterName("mode", false);
+  SetModeCmd->SetCandidates("kill roulette");
+  SetModeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetSurvivalCmd = new G4UIcmdWithADouble("/FP/limit/survival", this);
+  SetSurvivalCmd->SetGuidance("Survival probability of the roulette");
+  SetSurvivalCmd->SetParameterName("p", false);
+  SetSurvivalCmd->SetRange("p > 0. && p <= 1.");
+  SetSurvivalCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPhotonLimiterMessenger::~FPPhotonLimiterMessenger()
+{
+  delete SetEnableCmd;
+  delete SetMaxBouncesCmd;
+  delete SetMaxPathLengthCmd;
+  delete SetModeCmd;
+  delete SetSurvivalCmd;
+  delete limitDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPPhotonLimiterMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPLimiter->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetMaxBouncesCmd ) {
+      FPLimiter->SetMaxBounces(SetMaxBouncesCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetMaxPathLengthCmd ) {
+      FPLimiter->SetMaxPathLength(SetMaxPathLengthCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetModeCmd ) {
+      FPLimiter->SetMode(newValues == "roulette" ? FPPhotonLimiter::kRoulette
+			 : FPPhotonLimiter::kKill);
+    }
+
+    if (command == SetSurvivalCmd ) {
+      FPLimiter->SetSurvival(SetSurvivalCmd->GetNewDoubleValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -11,11 +11,24 @@
 ///                 August 5, 2020: Hexc and Zachary
 ///                 Implementing particle type options:
 ///                      partileType:   0 - optical photons (default);   1 - muons
+///
+///                 October 19, 2026:
+///                 Particle type 2: replay primaries, possibly several per event, from a
+///                 memory-mapped binary file indexed by the event ID.
+///
+///                 October 19, 2026:
+///                 No primaries for the events completed before a checkpointed run was
+///                 interrupted.
 
 #include "FPPrimaryGeneratorAction.hh"
 #include "FPPrimaryGeneratorMessenger.hh"
+#include "FPPrimaryReplayFile.hh"
+#include "FPCheckpoint.hh"
 #include "G4RunManager.hh"
 #include "G4Event.hh"
+#include "G4PrimaryVertex.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4OpticalPhoton.hh"
 #include "G4LogicalVolumeStore.hh"
 #include "G4LogicalVolume.hh"
 #include "G4Box.hh"
@@ -32,7 +45,10 @@
 
 FPPrimaryGeneratorAction::FPPrimaryGeneratorAction()
  : G4VUserPrimaryGeneratorAction(),
-   fParticleGun(0)
+   fParticleGun(0),
+   fReplayFile(nullptr),
+   fLastPDG(0),
+   fLastDefinition(nullptr)
 {
   G4int n_particle = 1;
   fParticleGun  = new G4ParticleGun(n_particle);
@@ -59,9 +75,23 @@ FPPrimaryGeneratorAction::~FPPrimaryGeneratorAction()
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+void FPPrimaryGeneratorAction::SetReplayFile(const G4String& fileName)
+{
+  fReplayFile = FPPrimaryReplayFile::Get(fileName);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void FPPrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent)
 {
   // This function is called at the begining of event
+  if (FPCheckpoint::Instance()->SkipEvent(anEvent->GetEventID())) return;
+
+  if (particleType == 2) {
+    GenerateReplayedPrimaries(anEvent);
+    return;
+  }
+
   G4ParticleDefinition* particle;
   
   G4ParticleTable* particleTable = G4ParticleTable::GetParticleTable();
@@ -133,4 +163,57 @@ void FPPrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent)
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
-  
+
+void FPPrimaryGeneratorAction::GenerateReplayedPrimaries(G4Event* anEvent)
+{
+  if (!fReplayFile) {
+    G4Exception("FPPrimaryGeneratorAction::GenerateReplayedPrimaries()", "FPReplay010",
+		JustWarning, "No primary replay file, use /FP/gun/replayFile first");
+    return;
+  }
+
+  std::size_t nPrimaries = 0;
+  const FPReplayPrimary* primary = fReplayFile->GetEvent(anEvent->GetEventID(), nPrimaries);
+  if (!primary) {
+    G4ExceptionDescription msg;
+    msg << "Event " << anEvent->GetEventID() << " is beyond the "
+	<< fReplayFile->GetNumberOfEvents() << " events of " << fReplayFile->GetFileName();
+    G4Exception("FPPrimaryGeneratorAction::GenerateReplayedPrimaries()", "FPReplay011",
+		JustWarning, msg);
+    return;
+  }
+
+  G4ParticleTable* particleTable = G4ParticleTable::GetParticleTable();
+
+  for (std::size_t i = 0; i < nPrimaries; i++, primary++) {
+    // Consecutive primaries are mostly of the same kind: skip the table lookup
+    if (!fLastDefinition || primary->pdg != fLastPDG) {
+      fLastPDG = primary->pdg;
+      if (fLastPDG == 0 || fLastPDG == -22) fLastDefinition = G4OpticalPhoton::Definition();
+      else fLastDefinition = particleTable->FindParticle(fLastPDG);
+      if (!fLastDefinition) {
+	G4ExceptionDescription msg;
+	msg << "Unknown PDG code " << fLastPDG << " in " << fReplayFile->GetFileName();
+	G4Exception("FPPrimaryGeneratorAction::GenerateReplayedPrimaries()", "FPReplay012",
+		    JustWarning, msg);
+	continue;
+      }
+    }
+
+    auto vertex = new G4PrimaryVertex(G4ThreeVector(primary->x, primary->y, primary->z), primary->t);
+    auto particle = new G4PrimaryParticle(fLastDefinition);
+    particle->SetKineticEnergy(primary->energy);
+    particle->SetMomentumDirection(G4ThreeVector(primary->dx, primary->dy, primary->dz).unit());
+    if (fLastDefinition == G4OpticalPhoton::Definition()) {
+      // Random linear polarization, as done by G4ParticleGun for optical photons
+      G4ThreeVector dir = particle->GetMomentumDirection();
+      G4ThreeVector pol = dir.orthogonal().unit();
+      pol.rotate(G4UniformRand()*360.*deg, dir);
+      particle->SetPolarization(pol);
+    }
+    vertex->SetPrimary(particle);
+    anEvent->AddPrimaryVertex(vertex);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
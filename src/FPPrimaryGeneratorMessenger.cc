@@ -5,6 +5,7 @@
 ///                 Implementing particle type choices:  0 for optical photons; 1 for muons.
 /// February 12, 2025: Hexc, Munir, Shahid, Jerad, Elsayed
 ///                 Verifying the gun position and particle type
+/// October 19, 2026: Added /FP/gun/replayFile for replaying primaries from a binary file
 
 #include "globals.hh"
 
@@ -15,6 +16,7 @@
 #include "G4UIcmdWithADoubleAndUnit.hh"
 #include "G4UIcmdWithAnInteger.hh"
 #include "G4UIcmdWith3VectorAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
 
 #include "CLHEP/Units/SystemOfUnits.h"
 
@@ -39,10 +41,18 @@ FPPrimaryGeneratorMessenger::FPPrimaryGeneratorMessenger(
   // New event type message
   SetGunParticleType = new G4UIcmdWithAnInteger("/FP/gun/particleType", this);
   SetGunParticleType->SetGuidance("Set particle type");
-  SetGunParticleType->SetGuidance("       Choice :  0, 1");
+  SetGunParticleType->SetGuidance("       Choice :  0, 1, 2");
+  SetGunParticleType->SetGuidance("       0: optical photon, 1: mu-, 2: replay from file");
   SetGunParticleType->SetParameterName("particleType", true);
   SetGunParticleType->SetDefaultValue(0);
   SetGunParticleType->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  // Replay primaries from a memory-mapped binary file
+  SetReplayFileCmd = new G4UIcmdWithAString("/FP/gun/replayFile", this);
+  SetReplayFileCmd->SetGuidance("Binary primary file replayed for particle type 2");
+  SetReplayFileCmd->SetGuidance("Event N of the run takes the primaries of record N.");
+  SetReplayFileCmd->SetParameterName("fileName", false);
+  SetReplayFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -51,6 +61,7 @@ FPPrimaryGeneratorMessenger::~FPPrimaryGeneratorMessenger()
 {
   delete SetGunPositionCmd;
   delete SetGunParticleType;
+  delete SetReplayFileCmd;
   delete gunDir;
 }
 
@@ -68,6 +79,10 @@ void FPPrimaryGeneratorMessenger::SetNewValue(
       G4int particleType = SetGunParticleType->GetNewIntValue(newValues);
       FPAction->SetGunParticleType(particleType);
     }  
+
+    if (command == SetReplayFileCmd ) {
+      FPAction->SetReplayFile(newValues);
+    }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,189 @@
+/// October 19, 2026: Memory-mapped primary-event replay file.
+///
+///    The mapping is opened once per process under a mutex and is read-only
+///    afterwards; per-event access is a plain pointer lookup.
+///    Files are written by Write() (see tools/fpReplayConvert).
+
+#include "FPPrimaryReplayFile.hh"
+
+#include "G4AutoLock.hh"
+
+#include <map>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  G4Mutex replayMutex = G4MUTEX_INITIALIZER;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+struct FPPrimaryReplayRegistry
+{
+  ~FPPrimaryReplayRegistry()
+  {
+    for (auto& entry : files) delete entry.second;
+  }
+
+  std::map<G4String, FPPrimaryReplayFile*> files;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+const FPPrimaryReplayFile* FPPrimaryReplayFile::Get(const G4String& fileName)
+{
+  static FPPrimaryReplayRegistry registry;
+
+  G4AutoLock lock(&replayMutex);
+
+  auto itr = registry.files.find(fileName);
+  if (itr != registry.files.end()) return itr->second;
+
+  auto replayFile = new FPPrimaryReplayFile(fileName);
+  if (!replayFile->Map()) {
+    delete replayFile;
+    replayFile = nullptr;
+  }
+  // Also remember failures, so that every thread does not retry and warn again
+  registry.files[fileName] = replayFile;
+  return replayFile;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPrimaryReplayFile::FPPrimaryReplayFile(const G4String& fileName)
+  : fFileName(fileName),
+    fMapping(nullptr),
+    fMappingSize(0),
+    fHeader(nullptr),
+    fEventIndex(nullptr),
+    fPrimaries(nullptr)
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPPrimaryReplayFile::~FPPrimaryReplayFile()
+{
+  if (fMapping) munmap(fMapping, fMappingSize);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPPrimaryReplayFile::Map()
+{
+  int fd = open(fFileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    G4ExceptionDescription msg;
+    msg << "Can not open primary replay file " << fFileName;
+    G4Exception("FPPrimaryReplayFile::Map()", "FPReplay001", JustWarning, msg);
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(FPReplayHeader)) {
+    close(fd);
+    G4ExceptionDescription msg;
+    msg << "Primary replay file " << fFileName << " is too short";
+    G4Exception("FPPrimaryReplayFile::Map()", "FPReplay002", JustWarning, msg);
+    return false;
+  }
+
+  fMappingSize = st.st_size;
+  void* mapping = mmap(nullptr, fMappingSize, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);   // the mapping keeps the file alive
+  if (mapping == MAP_FAILED) {
+    G4ExceptionDescription msg;
+    msg << "mmap failed for primary replay file " << fFileName;
+    G4Exception("FPPrimaryReplayFile::Map()", "FPReplay003", JustWarning, msg);
+    return false;
+  }
+  fMapping = mapping;
+
+  // Events are read in increasing ID order, mostly
+  madvise(fMapping, fMappingSize, MADV_SEQUENTIAL);
+
+  fHeader = static_cast<const FPReplayHeader*>(fMapping);
+  // Counts bounded by what the file can hold before any product, so that a
+  // corrupt header can not wrap the expected size around to the file size
+  std::size_t payload = fMappingSize - sizeof(FPReplayHeader);
+  G4bool countsFit = fHeader->nEvents < payload/sizeof(std::uint64_t)
+    && fHeader->nPrimaries <= payload/sizeof(FPReplayPrimary);
+  std::size_t indexSize = countsFit ? (fHeader->nEvents + 1)*sizeof(std::uint64_t) : 0;
+  std::size_t expected = countsFit ? sizeof(FPReplayHeader) + indexSize
+    + fHeader->nPrimaries*sizeof(FPReplayPrimary) : 0;
+
+  G4String problem;
+  if (std::strncmp(fHeader->magic, "FPREPLY", 8) != 0)          problem = "bad magic";
+  else if (fHeader->version != 1)                                problem = "unsupported version";
+  else if (fHeader->recordSize != sizeof(FPReplayPrimary))       problem = "unexpected record size";
+  else if (!countsFit || expected != fMappingSize)               problem = "size does not match header";
+
+  if (problem.empty()) {
+    fEventIndex = reinterpret_cast<const std::uint64_t*>(
+                    static_cast<const char*>(fMapping) + sizeof(FPReplayHeader));
+    fPrimaries  = reinterpret_cast<const FPReplayPrimary*>(
+                    static_cast<const char*>(fMapping) + sizeof(FPReplayHeader) + indexSize);
+    if (fEventIndex[0] != 0 || fEventIndex[fHeader->nEvents] != fHeader->nPrimaries)
+      problem = "inconsistent event index";
+    // GetEvent() trusts the index: it must never point past the primaries
+    for (std::uint64_t i = 1; problem.empty() && i <= fHeader->nEvents; i++) {
+      if (fEventIndex[i] < fEventIndex[i-1] || fEventIndex[i] > fHeader->nPrimaries)
+	problem = "event index not monotonic or out of range";
+    }
+  }
+
+  if (!problem.empty()) {
+    G4ExceptionDescription msg;
+    msg << "Primary replay file " << fFileName << ": " << problem;
+    G4Exception("FPPrimaryReplayFile::Map()", "FPReplay004", JustWarning, msg);
+    return false;
+  }
+
+  G4cout << "Primary replay file " << fFileName << ": " << fHeader->nEvents
+	 << " events, " << fHeader->nPrimaries << " primaries" << G4endl;
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPPrimaryReplayFile::Write(const G4String& fileName,
+				  const std::vector<std::uint64_t>& eventIndex,
+				  const std::vector<FPReplayPrimary>& primaries)
+{
+  if (eventIndex.empty() || eventIndex.front() != 0 || eventIndex.back() != primaries.size()) {
+    G4ExceptionDescription msg;
+    msg << "Inconsistent event index for primary replay file " << fileName;
+    G4Exception("FPPrimaryReplayFile::Write()", "FPReplay005", JustWarning, msg);
+    return false;
+  }
+
+  FPReplayHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::strncpy(header.magic, "FPREPLY", sizeof(header.magic));
+  header.version    = 1;
+  header.recordSize = sizeof(FPReplayPrimary);
+  header.nEvents    = eventIndex.size() - 1;
+  header.nPrimaries = primaries.size();
+
+  std::ofstream outfile(fileName, std::ios::binary | std::ios::trunc);
+  outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  outfile.write(reinterpret_cast<const char*>(eventIndex.data()),
+		eventIndex.size()*sizeof(std::uint64_t));
+  outfile.write(reinterpret_cast<const char*>(primaries.data()),
+		primaries.size()*sizeof(FPReplayPrimary));
+  outfile.close();
+  if (!outfile) {
+    G4ExceptionDescription msg;
+    msg << "Can not write primary replay file " << fileName;
+    G4Exception("FPPrimaryReplayFile::Write()", "FPReplay006", JustWarning, msg);
+    return false;
+  }
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
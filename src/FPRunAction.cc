@@ -8,9 +8,48 @@
 ///Updated:  Sep 23, 2020 hexc & Zachary
 ///         Added analyzing histograms for photons collected by SiPM
 ///         
+/// October 19, 2026: Rebuild the stepping action dispatch lists at the beginning of each run,
+///         after the run's UI commands have enabled or disabled the step consumers.
+///         The spatial maps and photon fates are merged as accumulables and reported
+///         by the master. Welford statistics of the light yield and eLoss; the run
+///         may stop itself through FPRunControl. Workers write checkpoints of their
+///         completed events; the master restores those of an interrupted run.
+///         The histograms are booked and filled by static functions shared with
+///         fpMerge, and the output file name may be set by /analysis/setFileName.
+///         Own the SiPM digitizer, the raw hit stream and the trajectory filter of the thread.
+///         Own the coincidence trigger of the thread; its counts are merged and checkpointed.
+///         Same for the readout time gate and the photon limiter.
+///         The histograms are booked by the first run only (a long-lived process runs many),
+///         and the master keeps a copy of the merged ones for FPSimulation.
+///         Energy-loss-only runs write the eLoss histogram only and print the eLoss summary.
+///         Memory report of the threads (FPMemoryReport).
+///         Live status file of the run (FPTelemetry).
+///         Process tables of the optical properties changed between runs rebuilt per thread.
+///         The accumulable states of a checkpoint are added back at the end of the run,
+///         so that the shards written by a sequential run do not include them.
+///         Energy-loss-only runs leave the light yield out of the statistics, and the
+///         run control then targets the precision of the eLoss.
+///         Events cut short by the coincidence trigger are left out of the light yield
+///         and the nPhotons histogram, and counted apart.
+///         The photon limiter plays no roulette in a run with the trigger or the digitizer.
+///
 
 #include "FPRunAction.hh"
 #include "FPPrimaryGeneratorAction.hh"
+#include "FPSteppingAction.hh"
+#include "FPSpatialMaps.hh"
+#include "FPPhotonFates.hh"
+#include "FPSiPMDigitizer.hh"
+#include "FPHitStream.hh"
+#include "FPTrajectoryFilter.hh"
+#include "FPCoincidenceTrigger.hh"
+#include "FPTimeGate.hh"
+#include "FPPhotonLimiter.hh"
+#include "FPRunControl.hh"
+#include "FPCheckpoint.hh"
+#include "FPOpticalControl.hh"
+#include "FPMemoryReport.hh"
+#include "FPTelemetry.hh"
 
 #include "G4RunManager.hh"
 #include "G4Run.hh"
@@ -19,6 +58,8 @@
 #include "G4SystemOfUnits.hh"
 #include "G4RootAnalysisManager.hh"
 
+#include <sstream>
+
 //#include "g4root.hh"
 
 
@@ -26,17 +67,53 @@
 
 FPRunAction::FPRunAction()
  : G4UserRunAction(),
-   fPhotons(0)
+   fPhotons(0),
+   fLightYield("LightYield"),
+   fELoss("ELoss"),
+   fSteppingAction(nullptr),
+   fSpatialMaps(new FPSpatialMaps()),
+   fPhotonFates(new FPPhotonFates()),
+   fDigitizer(new FPSiPMDigitizer()),
+   fHitStream(new FPHitStream()),
+   fTrajectoryFilter(new FPTrajectoryFilter()),
+   fTrigger(new FPCoincidenceTrigger()),
+   fTimeGate(new FPTimeGate()),
+   fPhotonLimiter(new FPPhotonLimiter())
 {  
   // Register accumulable to the accumulable manager
   G4AccumulableManager* accumulableManager = G4AccumulableManager::Instance();
   accumulableManager->RegisterAccumulable(fPhotons);
+  accumulableManager->RegisterAccumulable(fLightYield);
+  accumulableManager->RegisterAccumulable(fELoss);
+  accumulableManager->RegisterAccumulable(fSpatialMaps);
+  accumulableManager->RegisterAccumulable(fPhotonFates);
+  accumulableManager->RegisterAccumulable(fDigitizer);
+  accumulableManager->RegisterAccumulable(fTrigger);
+  accumulableManager->RegisterAccumulable(fTimeGate);
+  accumulableManager->RegisterAccumulable(fPhotonLimiter);
+
+  // Create the analysis manager and the shared run services now, so that
+  // their commands exist before the first run
+  G4RootAnalysisManager::Instance();
+  FPRunControl::Instance();
+  FPCheckpoint::Instance();
+  FPMemoryReport::Instance();
+  FPTelemetry::Instance();
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 FPRunAction::~FPRunAction()
-{ }
+{
+  delete fSpatialMaps;
+  delete fPhotonFates;
+  delete fDigitizer;
+  delete fHitStream;
+  delete fTrajectoryFilter;
+  delete fTrigger;
+  delete fTimeGate;
+  delete fPhotonLimiter;
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -48,28 +125,242 @@ void FPRunAction::BeginOfRunAction(const G4Run* run)
   G4AccumulableManager* accumulableManager = G4AccumulableManager::Instance();
   accumulableManager->Reset();
 
+  // Size the spatial maps for this run's settings
+  fSpatialMaps->BeginOfRun();
+  fPhotonFates->BeginOfRun();
+  fDigitizer->BeginOfRun();
+  fHitStream->BeginOfRun(run->GetRunID());
+  fTrigger->BeginOfRun();
+  fPhotonLimiter->BeginOfRun(fTrigger->IsEnabled() || fDigitizer->IsEnabled());
+
+  // The master resets the shared run control and sets up the checkpoint
+  // (restoring its random engine) before the workers start
+  if (IsMaster()) {
+    FPRunControl::Instance()->BeginOfRun(FPOpticalControl::Instance()->IsELossOnly());
+    FPCheckpoint::Instance()->BeginOfRun(run->GetRunID());
+    FPMemoryReport::Instance()->BeginOfRun();
+    FPTelemetry::Instance()->BeginOfRun(run->GetRunID(), run->GetNumberOfEventToBeProcessed());
+  }
+  FPRunControl::Instance()->BeginOfThreadRun();
+  FPCheckpoint::Instance()->BeginOfThreadRun();
+  FPMemoryReport::Instance()->BeginOfThreadRun();
+  FPTelemetry::Instance()->BeginOfThreadRun();
+  // Optical properties changed since the last run of this thread
+  if (!IsMaster() || !G4Threading::IsMultithreadedApplication()) {
+    FPOpticalControl::Instance()->UpdatePhysicsTables();
+  }
+  fCheckpointShard = FPCheckpointShard();
+
+  // Route steps only to the consumers active for this run
+  if (fSteppingAction) fSteppingAction->UpdateConsumers();
+
   G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
   analysisManager->SetVerboseLevel(1);
-  // Open an output file  
-  analysisManager->OpenFile("fiberPanel.root"); 
-  // Create histograms  
-  analysisManager->CreateH1("nPhotons", "Number of Photons", 100, 0, 100);  
-  analysisManager->CreateH1("eLoss", "ELoss", 300, 0, 3);  
+  // Open an output file (the name may be set by /analysis/setFileName, as in split jobs)
+  if (analysisManager->GetFileName().empty()) analysisManager->SetFileName("fiberPanel.root");
+  analysisManager->OpenFile();
+  // Create histograms, once: closing the file resets them for the next run
+  if (analysisManager->GetNofH1s() == 0) BookHistograms();
+  // Energy-loss-only runs: the photon histogram is neither filled nor written
+  G4bool eLossOnly = FPOpticalControl::Instance()->IsELossOnly();
+  analysisManager->SetActivation(eLossOnly);
+  analysisManager->SetH1Activation(0, !eLossOnly);
+  fHistograms.clear();
   
   //inform the runManager to save random number seed
   G4RunManager::GetRunManager()->SetRandomNumberStore(false);
+
+  // Events done before an interruption
+  if (IsMaster()) RestoreCheckpoint();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::FillEventStats(G4int eventID, G4int nPhotons, G4double eLoss)
+{
+  FPEventRecord record = { eventID, nPhotons, eLoss };
+  FillEventSummary(record);
+
+  FPCheckpoint* checkpoint = FPCheckpoint::Instance();
+  if (checkpoint->IsEnabled()) {
+    fCheckpointShard.records.push_back(record);
+    if (checkpoint->IsDue()) WriteCheckpoint();
+  }
+
+  FPRunControl::Instance()->EndOfEvent(nPhotons, eLoss);
+  FPTelemetry::Instance()->EndOfEvent(nPhotons);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::FillEventSummary(const FPEventRecord& record)
+{
+  // Energy-loss-only runs produce no photons: no light yield to average;
+  // nor have the events whose photons the trigger killed
+  if (!FPOpticalControl::Instance()->IsELossOnly()
+      && record.nPhotons != FPEventRecord::kPhotonsNotCounted) {
+    if (record.nPhotons > 0) CountPhoton();
+    fLightYield.Fill(record.nPhotons);
+  }
+  fELoss.Fill(record.eLoss);
+
+  FillHistograms(record);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::BookHistograms()
+{
+  G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
+  analysisManager->CreateH1("nPhotons", "Number of Photons", 100, 0, 100);  
+  analysisManager->CreateH1("eLoss", "ELoss", 300, 0, 3);  
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::FillHistograms(const FPEventRecord& record)
+{
+  G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
+  if (record.nPhotons != FPEventRecord::kPhotonsNotCounted) {
+    analysisManager->FillH1(0, record.nPhotons);
+  }
+  analysisManager->FillH1(1, record.eLoss);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::SaveHistograms()
+{
+  // Merged with those of the workers by Write()
+  G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
+  for (G4int id = 0; id < analysisManager->GetNofH1s(); id++) {
+    auto h1 = analysisManager->GetH1(id);
+    if (!h1) continue;
+
+    FPHistogram histogram;
+    histogram.name = analysisManager->GetH1Name(id);
+    histogram.xmin = h1->axis().lower_edge();
+    histogram.xmax = h1->axis().upper_edge();
+    for (unsigned int bin = 0; bin < h1->axis().bins(); bin++) {
+      histogram.counts.push_back(h1->bin_Sw(bin));
+    }
+    fHistograms.push_back(histogram);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::WriteCheckpoint()
+{
+  // The accumulables not rebuilt from the event records
+  if (fSpatialMaps->IsEnabled()) {
+    std::ostringstream maps;
+    fSpatialMaps->Save(maps);
+    fCheckpointShard.states["SpatialMaps"] = maps.str();
+  }
+  if (fPhotonFates->IsEnabled()) {
+    std::ostringstream fates;
+    fPhotonFates->Save(fates);
+    fCheckpointShard.states["PhotonFates"] = fates.str();
+  }
+  if (fDigitizer->IsEnabled()) {
+    std::ostringstream digitizer;
+    fDigitizer->Save(digitizer);
+    fCheckpointShard.states["SiPMDigitizer"] = digitizer.str();
+  }
+  if (fTrigger->IsEnabled()) {
+    std::ostringstream trigger;
+    fTrigger->Save(trigger);
+    fCheckpointShard.states["CoincidenceTrigger"] = trigger.str();
+  }
+  if (fTimeGate->IsEnabled()) {
+    std::ostringstream gate;
+    fTimeGate->Save(gate);
+    fCheckpointShard.states["TimeGate"] = gate.str();
+  }
+  if (fPhotonLimiter->IsEnabled()) {
+    std::ostringstream limiter;
+    fPhotonLimiter->Save(limiter);
+    fCheckpointShard.states["PhotonLimiter"] = limiter.str();
+  }
+  fCheckpointShard.engineState = FPCheckpoint::SaveEngine();
+
+  FPCheckpoint::Instance()->WriteShard(fCheckpointShard);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::RestoreCheckpoint()
+{
+  // The event records refill statistics that are not part of the shards
+  for (const auto& shard : FPCheckpoint::Instance()->GetRestoredShards()) {
+    for (const auto& record : shard.records) FillEventSummary(record);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunAction::RestoreCheckpointStates()
+{
+  // Added at the end of the run only, after the last shard of this run action
+  // is written: in sequential mode the master is also the worker, and its
+  // shards must hold the new events only
+  for (const auto& shard : FPCheckpoint::Instance()->GetRestoredShards()) {
+    auto maps = shard.states.find("SpatialMaps");
+    if (maps != shard.states.end() && fSpatialMaps->IsEnabled()) {
+      std::istringstream in(maps->second);
+      fSpatialMaps->Restore(in);
+    }
+    auto fates = shard.states.find("PhotonFates");
+    if (fates != shard.states.end() && fPhotonFates->IsEnabled()) {
+      std::istringstream in(fates->second);
+      fPhotonFates->Restore(in);
+    }
+    auto digitizer = shard.states.find("SiPMDigitizer");
+    if (digitizer != shard.states.end() && fDigitizer->IsEnabled()) {
+      std::istringstream in(digitizer->second);
+      fDigitizer->Restore(in);
+    }
+    auto trigger = shard.states.find("CoincidenceTrigger");
+    if (trigger != shard.states.end() && fTrigger->IsEnabled()) {
+      std::istringstream in(trigger->second);
+      fTrigger->Restore(in);
+    }
+    auto gate = shard.states.find("TimeGate");
+    if (gate != shard.states.end() && fTimeGate->IsEnabled()) {
+      std::istringstream in(gate->second);
+      fTimeGate->Restore(in);
+    }
+    auto limiter = shard.states.find("PhotonLimiter");
+    if (limiter != shard.states.end() && fPhotonLimiter->IsEnabled()) {
+      std::istringstream in(limiter->second);
+      fPhotonLimiter->Restore(in);
+    }
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 void FPRunAction::EndOfRunAction(const G4Run* run)
 {
+  FPRunControl::Instance()->EndOfThreadRun();
+  if (FPCheckpoint::Instance()->IsEnabled() && !fCheckpointShard.records.empty()) WriteCheckpoint();
+  if (IsMaster()) RestoreCheckpointStates();
+  fHitStream->EndOfRun();
+  // Final status, once the workers are done
+  if (IsMaster()) FPTelemetry::Instance()->EndOfRun();
+
   G4int nofEvents = run->GetNumberOfEvent();
+  // The master of a multi-threaded run tracks no events
+  if (!IsMaster() || !G4Threading::IsMultithreadedApplication()) {
+    FPMemoryReport::Instance()->EndOfThreadRun(nofEvents);
+  }
   if (nofEvents == 0) return;
   
   // Merge accumulables 
   G4AccumulableManager* accumulableManager = G4AccumulableManager::Instance();
   accumulableManager->Merge();
+  if (IsMaster()) fSpatialMaps->Write();
 
   // Run conditions
   //  note: There is no primary generator action object for "master"
@@ -104,15 +395,40 @@ void FPRunAction::EndOfRunAction(const G4Run* run)
      << "  The run was " << nofEvents << " "<< partName;
   }
   
-  G4cout
+  G4bool eLossOnly = FPOpticalControl::Instance()->IsELossOnly();
+  if (eLossOnly) {
+    G4cout << "; eLoss only" << G4endl;
+  } else {
+    G4cout
      << "; Number of photons " << fPhotons.GetValue()  << G4endl
+     << "  Light yield " << fLightYield.GetStats().GetMean() << " +- " << fLightYield.GetStats().GetError()
+     << " photons/event (RMS " << fLightYield.GetStats().GetRMS() << ")" << G4endl;
+    G4long nCutShort = fELoss.GetStats().GetN() - fLightYield.GetStats().GetN();
+    if (nCutShort > 0) {
+      G4cout << "  Rejected early by the trigger " << nCutShort
+	     << " events, not in the light yield" << G4endl;
+    }
+  }
+  G4cout
+     << "  ELoss " << G4BestUnit(fELoss.GetStats().GetMean(), "Energy")
+     << " +- " << G4BestUnit(fELoss.GetStats().GetError(), "Energy") << "/event" << G4endl
      << "------------------------------------------------------------" << G4endl 
      << G4endl;
+  if (IsMaster() && !eLossOnly) {
+    fPhotonFates->Print();
+    fDigitizer->Print();
+    fTrigger->Print();
+    fTimeGate->Print();
+    fPhotonLimiter->Print();
+  }
+  if (IsMaster()) FPRunControl::Instance()->Print();
+  if (IsMaster()) FPMemoryReport::Instance()->EndOfRun(run->GetRunID());
 
   // Get analysis manager
   G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
   // Write and close the output file
   analysisManager->Write();  
+  if (IsMaster()) SaveHistograms();
   analysisManager->CloseFile();
 
 }
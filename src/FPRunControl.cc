@@ -0,0 +1,162 @@
+/// October 19, 2026: Precision-driven and time-budgeted run control.
+
+#include "FPRunControl.hh"
+#include "FPRunControlMessenger.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4AutoLock.hh"
+#include "G4RunManager.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UnitsTable.hh"
+
+#include <iomanip>
+
+G4ThreadLocal FPRunControl::LocalStats* FPRunControl::fgLocal = nullptr;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPRunControl* FPRunControl::Instance()
+{
+  // Created by the first run action (on the master) and kept for the whole job
+  static FPRunControl* instance = new FPRunControl();
+  return instance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPRunControl::FPRunControl()
+  : fEnabled(false),
+    fQuantity(kLightYield),
+    fTargetRelError(0.01),
+    fEfficiencyThreshold(1),
+    fTimeBudget(0.),
+    fMinEvents(100),
+    fCheckInterval(100),
+    fStopReason(kNotStopped),
+    fELossOnly(false),
+    fStop(false),
+    fStartTime(std::chrono::steady_clock::now())
+{
+  fMessenger = new FPRunControlMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPRunControl::~FPRunControl()
+{
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunControl::BeginOfRun(G4bool eLossOnly)
+{
+  G4AutoLock lock(&fMutex);
+  fELossOnly = eLossOnly;
+  fLightYield.Reset();
+  fEfficiency.Reset();
+  fELoss.Reset();
+  fStopReason = kNotStopped;
+  fStop = false;
+  fStartTime = std::chrono::steady_clock::now();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunControl::BeginOfThreadRun()
+{
+  if (!fgLocal) fgLocal = new LocalStats;
+  *fgLocal = LocalStats();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double FPRunControl::GetElapsedSeconds() const
+{
+  return std::chrono::duration<G4double>(std::chrono::steady_clock::now() - fStartTime).count();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPRunControl::EndOfEvent(G4int nPhotons, G4double eLoss)
+{
+  if (!fEnabled) return false;
+  if (!fgLocal) BeginOfThreadRun();
+
+  // An event cut short by the trigger has no photon count (nPhotons < 0)
+  if (!fELossOnly && nPhotons >= 0) {
+    fgLocal->lightYield.Fill(nPhotons);
+    fgLocal->efficiency.Fill(nPhotons >= fEfficiencyThreshold ? 1. : 0.);
+  }
+  fgLocal->eLoss.Fill(eLoss);
+  if (++fgLocal->nEvents >= fCheckInterval) MergeLocal();
+  // The time budget is also checked at each event: at a low event rate the
+  // check interval alone may overrun it by far
+  else if (fTimeBudget > 0. && !fStop.load(std::memory_order_relaxed)
+	   && GetElapsedSeconds() > fTimeBudget) MergeLocal();
+
+  if (fStop.load(std::memory_order_relaxed)) {
+    G4RunManager::GetRunManager()->AbortRun(true);
+    return true;
+  }
+  return false;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunControl::EndOfThreadRun()
+{
+  if (fEnabled && fgLocal && fgLocal->nEvents > 0) MergeLocal();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunControl::MergeLocal()
+{
+  G4AutoLock lock(&fMutex);
+  fLightYield.Merge(fgLocal->lightYield);
+  fEfficiency.Merge(fgLocal->efficiency);
+  fELoss.Merge(fgLocal->eLoss);
+  *fgLocal = LocalStats();
+
+  if (fStopReason != kNotStopped) return;
+
+  // The time budget holds whatever the number of events; the minimum number
+  // of events only protects the precision estimate
+  const FPWelford& stats = fELossOnly ? fELoss
+    : (fQuantity == kLightYield) ? fLightYield : fEfficiency;
+  if (fTimeBudget > 0. && GetElapsedSeconds() > fTimeBudget) {
+    fStopReason = kTimeBudget;
+  } else if (fELoss.GetN() >= fMinEvents && fTargetRelError > 0.
+	     && stats.GetRelativeError() < fTargetRelError) {
+    fStopReason = kPrecisionReached;
+  }
+  if (fStopReason != kNotStopped) fStop = true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunControl::Print() const
+{
+  if (!fEnabled) return;
+
+  FPPrecisionGuard precisionGuard;
+  G4cout << G4endl << " Run control: " << fELoss.GetN() << " events in "
+	 << std::setprecision(4) << GetElapsedSeconds() << " s";
+  if (fStopReason == kPrecisionReached) G4cout << ", stopped on the target precision";
+  else if (fStopReason == kTimeBudget) G4cout << ", stopped on the time budget";
+  G4cout << G4endl;
+  if (!fELossOnly) {
+    G4cout
+	 << "   light yield : " << fLightYield.GetMean() << " +- " << fLightYield.GetError()
+	 << " photons/event (rel. error " << fLightYield.GetRelativeError() << ")" << G4endl
+	 << "   efficiency  : " << fEfficiency.GetMean() << " +- " << fEfficiency.GetError()
+	 << " (>= " << fEfficiencyThreshold << " photons, rel. error "
+	 << fEfficiency.GetRelativeError() << ")" << G4endl;
+  }
+  G4cout << "   eLoss       : " << G4BestUnit(fELoss.GetMean(), "Energy") << " +- "
+	 << G4BestUnit(fELoss.GetError(), "Energy") << " (rel. error "
+	 << fELoss.GetRelativeError() << ")" << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,137 @@
+/// October 19, 2026: Run control messenger.
+///
+///    /FP/run/autoStop            : stop the run on precision or time, /run/beamOn is the maximum
+///    /FP/run/target              : quantity whose precision is targeted (lightYield or efficiency)
+///    /FP/run/targetRelError      : target relative error on the mean of that quantity
+///    /FP/run/efficiencyThreshold : detected photons for an event to count as efficient
+///    /FP/run/timeBudget          : wall-clock budget of the run
+///    /FP/run/minEvents           : never stop on precision before this number of events
+///    /FP/run/checkInterval       : events of a thread between two checks
+///
+///    The run control is shared by all threads: the commands are not broadcast.
+
+#include "globals.hh"
+
+#include "FPRunControlMessenger.hh"
+
+#include "FPRunControl.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4SystemOfUnits.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPRunControlMessenger::FPRunControlMessenger(FPRunControl* FPCtrl)
+:FPControl(FPCtrl)
+{
+  runDir = new G4UIdirectory("/FP/run/");
+  runDir->SetGuidance("Run length control:");
+
+  SetAutoStopCmd = new G4UIcmdWithABool("/FP/run/autoStop", this);
+  SetAutoStopCmd->SetGuidance("Stop the run once the target precision is reached or the time");
+  SetAutoStopCmd->SetGuidance("budget is used up; /run/beamOn gives the maximum number of events.");
+  SetAutoStopCmd->SetParameterName("enable", true);
+  SetAutoStopCmd->SetDefaultValue(true);
+  SetAutoStopCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetAutoStopCmd->SetToBeBroadcasted(false);
+
+  SetTargetCmd = new G4UIcmdWithAString("/FP/run/target", this);
+  SetTargetCmd->SetGuidance("Quantity whose relative error is targeted");
+  SetTargetCmd->SetGuidance("(energy-loss-only runs always target the mean eLoss).");
+  SetTargetCmd->SetParameterName("quantity", false);
+  SetTargetCmd->SetCandidates("lightYield efficiency");
+  SetTargetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetTargetCmd->SetToBeBroadcasted(false);
+
+  SetTargetRelErrorCmd = new G4UIcmdWithADouble("/FP/run/targetRelError", this);
+  SetTargetRelErrorCmd->SetGuidance("Target relative error on the mean (0: no precision target)");
+  SetTargetRelErrorCmd->SetParameterName("relError", false);
+  SetTargetRelErrorCmd->SetRange("relError >= 0.");
+  SetTargetRelErrorCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetTargetRelErrorCmd->SetToBeBroadcasted(false);
+
+  SetEfficiencyThresholdCmd = new G4UIcmdWithAnInteger("/FP/run/efficiencyThreshold", this);
+  SetEfficiencyThresholdCmd->SetGuidance("Minimum number of detected photons of an efficient event");
+  SetEfficiencyThresholdCmd->SetParameterName("nPhotons", false);
+  SetEfficiencyThresholdCmd->SetRange("nPhotons >= 1");
+  SetEfficiencyThresholdCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetEfficiencyThresholdCmd->SetToBeBroadcasted(false);
+
+  SetTimeBudgetCmd = new G4UIcmdWithADoubleAndUnit("/FP/run/timeBudget", this);
+  SetTimeBudgetCmd->SetGuidance("Wall-clock budget of the run (0: none)");
+  SetTimeBudgetCmd->SetParameterName("budget", false);
+  SetTimeBudgetCmd->SetRange("budget >= 0.");
+  SetTimeBudgetCmd->SetUnitCategory("Time");
+  SetTimeBudgetCmd->SetDefaultUnit("s");
+  SetTimeBudgetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetTimeBudgetCmd->SetToBeBroadcasted(false);
+
+  SetMinEventsCmd = new G4UIcmdWithAnInteger("/FP/run/minEvents", this);
+  SetMinEventsCmd->SetGuidance("Minimum number of events before the run may stop on precision");
+  SetMinEventsCmd->SetGuidance("(the time budget applies from the first event).");
+  SetMinEventsCmd->SetParameterName("nEvents", false);
+  SetMinEventsCmd->SetRange("nEvents >= 0");
+  SetMinEventsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetMinEventsCmd->SetToBeBroadcasted(false);
+
+  SetCheckIntervalCmd = new G4UIcmdWithAnInteger("/FP/run/checkInterval", this);
+  SetCheckIntervalCmd->SetGuidance("Events processed by a thread between two checks of the criteria");
+  SetCheckIntervalCmd->SetParameterName("nEvents", false);
+  SetCheckIntervalCmd->SetRange("nEvents >= 1");
+  SetCheckIntervalCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetCheckIntervalCmd->SetToBeBroadcasted(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPRunControlMessenger::~FPRunControlMessenger()
+{
+  delete SetAutoStopCmd;
+  delete SetTargetCmd;
+  delete SetTargetRelErrorCmd;
+  delete SetEfficiencyThresholdCmd;
+  delete SetTimeBudgetCmd;
+  delete SetMinEventsCmd;
+  delete SetCheckIntervalCmd;
+  delete runDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPRunControlMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetAutoStopCmd ) {
+      FPControl->SetEnabled(SetAutoStopCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetTargetCmd ) {
+      FPControl->SetQuantity(newValues == "efficiency" ? FPRunControl::kEfficiency
+			     : FPRunControl::kLightYield);
+    }
+
+    if (command == SetTargetRelErrorCmd ) {
+      FPControl->SetTargetRelativeError(SetTargetRelErrorCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetEfficiencyThresholdCmd ) {
+      FPControl->SetEfficiencyThreshold(SetEfficiencyThresholdCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetTimeBudgetCmd ) {
+      FPControl->SetTimeBudget(SetTimeBudgetCmd->GetNewDoubleValue(newValues)/s);
+    }
+
+    if (command == SetMinEventsCmd ) {
+      FPControl->SetMinEvents(SetMinEventsCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetCheckIntervalCmd ) {
+      FPControl->SetCheckInterval(SetCheckIntervalCmd->GetNewIntValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,212 @@
+/// October 19, 2026: Scintillation with batched photon generation.
+
+#include "FPScintillation.hh"
+#include "FPOpticalControl.hh"
+
+#include "G4RunManager.hh"
+#include "G4Run.hh"
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4DynamicParticle.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4PhysicsTable.hh"
+#include "G4PhysicsFreeVector.hh"
+#include "G4PhysicsModelCatalog.hh"
+#include "G4EmSaturation.hh"
+#include "G4Poisson.hh"
+#include "G4PhysicalConstants.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <cmath>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPScintillation::FPScintillation(const G4String& processName)
+  : G4Scintillation(processName),
+    fBatched(false),
+    fRunID(-1),
+    fCreatorModelID(G4PhysicsModelCatalog::GetModelID("model_Scintillation"))
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPScintillation::~FPScintillation()
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPScintillation::BuildPhysicsTable(const G4ParticleDefinition& particle)
+{
+  G4Scintillation::BuildPhysicsTable(particle);
+
+  // Invert the integrals of the first component, as rebuilt with the spectra
+  fInverseCDF.clear();
+  G4PhysicsTable* integrals = GetIntegralTable1();
+  if (!integrals) return;
+
+  fInverseCDF.resize(integrals->entries());
+  for (std::size_t i = 0; i < integrals->entries(); i++) {
+    auto integral = static_cast<G4PhysicsFreeVector*>((*integrals)(i));
+    if (!integral || integral->GetVectorLength() == 0) continue;
+    G4double total = integral->GetMaxValue();
+    if (total <= 0.) continue;
+
+    std::vector<G4double>& inverse = fInverseCDF[i];
+    inverse.resize(kInverseBins + 1);
+    for (G4int j = 0; j <= kInverseBins; j++) {
+      inverse[j] = integral->GetEnergy(total*j/kInverseBins);
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4VParticleChange* FPScintillation::PostStepDoIt(const G4Track& track, const G4Step& step)
+{
+  // The setting may have changed between runs
+  const G4Run* run = G4RunManager::GetRunManager()->GetCurrentRun();
+  G4int runID = run ? run->GetRunID() : -1;
+  if (runID != fRunID) {
+    fRunID = runID;
+    fBatched = FPOpticalControl::Instance()->IsBatchedScintillation();
+  }
+
+  if (!fBatched || !GetStackPhotons() || GetFiniteRiseTime()
+      || GetScintillationByParticleType() || GetScintillationTrackInfo()) {
+    return G4Scintillation::PostStepDoIt(track, step);
+  }
+
+  // One emission component, with its integral
+  const G4Material* material = track.GetMaterial();
+  const G4MaterialPropertiesTable* table = material->GetMaterialPropertiesTable();
+  std::size_t index = material->GetIndex();
+  if (!table || !table->GetProperty(kSCINTILLATIONCOMPONENT1)
+      || table->GetProperty(kSCINTILLATIONCOMPONENT2) || table->GetProperty(kSCINTILLATIONCOMPONENT3)
+      || index >= fInverseCDF.size() || fInverseCDF[index].empty()) {
+    return G4Scintillation::PostStepDoIt(track, step);
+  }
+
+  aParticleChange.Initialize(track);
+  G4int nPhotons = SampleNumberOfPhotons(step, table);
+  if (nPhotons <= 0) {
+    aParticleChange.SetNumberOfSecondaries(0);
+    return G4VRestDiscreteProcess::PostStepDoIt(track, step);
+  }
+  return BatchedPostStepDoIt(track, step, nPhotons, fInverseCDF[index]);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPScintillation::SampleNumberOfPhotons(const G4Step& step,
+					     const G4MaterialPropertiesTable* table) const
+{
+  G4double yield = table->GetConstProperty(kSCINTILLATIONYIELD);
+  G4EmSaturation* saturation = GetSaturation();
+  G4double meanNumberOfPhotons = saturation
+    ? yield*saturation->VisibleEnergyDepositionAtAStep(&step)
+    : yield*step.GetTotalEnergyDeposit();
+
+  if (meanNumberOfPhotons > 10.) {
+    G4double sigma = table->GetConstProperty(kRESOLUTIONSCALE)*std::sqrt(meanNumberOfPhotons);
+    return G4int(G4RandGauss::shoot(meanNumberOfPhotons, sigma) + 0.5);
+  }
+  return G4int(G4Poisson(meanNumberOfPhotons));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4VParticleChange* FPScintillation::BatchedPostStepDoIt(const G4Track& track, const G4Step& step,
+							G4int nPhotons,
+							const std::vector<G4double>& inverseCDF)
+{
+  aParticleChange.SetNumberOfSecondaries(nPhotons);
+  if (GetTrackSecondariesFirst() && track.GetTrackStatus() == fAlive) {
+    aParticleChange.ProposeTrackStatus(fSuspend);
+  }
+
+  // All the random numbers of the step in one call, one block per quantity
+  std::size_t n = nPhotons;
+  fRandoms.resize(kRandomsPerPhoton*n);
+  G4Random::getTheEngine()->flatArray(G4int(fRandoms.size()), fRandoms.data());
+  const G4double* rEnergy       = fRandoms.data();
+  const G4double* rCosTheta     = rEnergy + n;
+  const G4double* rPhi          = rCosTheta + n;
+  const G4double* rPolarization = rPhi + n;
+  const G4double* rPosition     = rPolarization + n;
+  const G4double* rTime         = rPosition + n;
+
+  fEnergy.resize(n);
+  fPx.resize(n);  fPy.resize(n);  fPz.resize(n);
+  fEx.resize(n);  fEy.resize(n);  fEz.resize(n);
+  fFraction.resize(n);
+  fTime.resize(n);
+
+  // Energies: the spectrum integral inverted at uniform steps
+  const G4double* inverse = inverseCDF.data();
+  for (std::size_t i = 0; i < n; i++) {
+    G4double u = rEnergy[i]*kInverseBins;
+    G4int j = std::min(G4int(u), kInverseBins - 1);
+    fEnergy[i] = inverse[j] + (u - j)*(inverse[j + 1] - inverse[j]);
+  }
+
+  // Isotropic directions, and linear polarizations perpendicular to them
+  // at a random angle (as G4Scintillation)
+  for (std::size_t i = 0; i < n; i++) {
+    G4double cost = 1. - 2.*rCosTheta[i];
+    G4double sint = std::sqrt((1. - cost)*(1. + cost));
+    G4double phi = twopi*rPhi[i];
+    G4double sinp = std::sin(phi);
+    G4double cosp = std::cos(phi);
+    G4double psi = twopi*rPolarization[i];
+    G4double sinpsi = std::sin(psi);
+    G4double cospsi = std::cos(psi);
+    fPx[i] = sint*cosp;
+    fPy[i] = sint*sinp;
+    fPz[i] = cost;
+    fEx[i] = cospsi*cost*cosp - sinpsi*sinp;
+    fEy[i] = cospsi*cost*sinp + sinpsi*cosp;
+    fEz[i] = -cospsi*sint;
+  }
+
+  // Emission point along the step (at its end for a neutral parent) and time
+  const G4StepPoint* preStepPoint = step.GetPreStepPoint();
+  const G4StepPoint* postStepPoint = step.GetPostStepPoint();
+  G4bool neutral = (track.GetDefinition()->GetPDGCharge() == 0.);
+  G4double length = step.GetStepLength();
+  G4double v0 = preStepPoint->GetVelocity();
+  G4double dv = postStepPoint->GetVelocity() - v0;
+  G4double t0 = preStepPoint->GetGlobalTime();
+  G4double decayTime = track.GetMaterial()->GetMaterialPropertiesTable()
+    ->GetConstProperty(kSCINTILLATIONTIMECONSTANT1);
+  for (std::size_t i = 0; i < n; i++) {
+    G4double fraction = neutral ? 1. : rPosition[i];
+    fFraction[i] = fraction;
+    fTime[i] = t0 + fraction*length/(v0 + fraction*dv/2.) - decayTime*std::log(rTime[i]);
+  }
+
+  // Tracks and dynamic particles of the photons
+  const G4ParticleDefinition* opticalPhoton = G4OpticalPhoton::Definition();
+  const G4ThreeVector& x0 = preStepPoint->GetPosition();
+  const G4ThreeVector& dx = step.GetDeltaPosition();
+  const G4TouchableHandle& touchable = preStepPoint->GetTouchableHandle();
+  G4int parentID = track.GetTrackID();
+  for (std::size_t i = 0; i < n; i++) {
+    G4DynamicParticle* photon =
+      new G4DynamicParticle(opticalPhoton, G4ThreeVector(fPx[i], fPy[i], fPz[i]));
+    photon->SetPolarization(G4ThreeVector(fEx[i], fEy[i], fEz[i]));
+    photon->SetKineticEnergy(fEnergy[i]);
+
+    G4Track* secondary = new G4Track(photon, fTime[i], x0 + fFraction[i]*dx);
+    secondary->SetTouchableHandle(touchable);
+    secondary->SetParentID(parentID);
+    secondary->SetCreatorModelID(fCreatorModelID);
+    aParticleChange.AddSecondary(secondary);
+  }
+
+  return G4VRestDiscreteProcess::PostStepDoIt(track, step);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,360 @@
+/// October 19, 2026: Digitization of the SiPM hits.
+///                   Feature statistics per channel.
+
+#include "FPSiPMDigitizer.hh"
+#include "FPSiPMDigitizerMessenger.hh"
+#include "FPPrecisionGuard.hh"
+
+#include "G4Box.hh"
+#include "G4LogicalVolume.hh"
+#include "G4LogicalVolumeStore.hh"
+#include "G4Poisson.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UnitsTable.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+
+G4ThreadLocal FPSiPMDigitizer* FPSiPMDigitizer::fgInstance = nullptr;
+
+namespace {
+
+  const char* avalancheNames[] = { "photons", "dark counts", "crosstalk", "afterpulses" };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSiPMDigitizer::FPSiPMDigitizer()
+  : G4VAccumulable("SiPMDigitizer"),
+    fEnabled(false),
+    fPDE(0.4),
+    fCellPitch(25.*um),
+    fRecoveryTime(20.*ns),
+    fCrosstalk(0.1),
+    fAfterpulse(0.05),
+    fAfterpulseTime(30.*ns),
+    fDarkRate(100.*kilohertz),
+    fGainSpread(0.1),
+    fRiseTime(1.*ns),
+    fFallTime(20.*ns),
+    fSampling(0.5*ns),
+    fGate(250.*ns),
+    fThreshold(0.5),
+    fNCellsY(0), fNCellsZ(0),
+    fHalfY(0.), fHalfZ(0.),
+    fPulseIntegral(0.),
+    fEventStamp(0),
+    fCharge(0.),
+    fAmplitude(0.),
+    fTime(-1.),
+    fNAvalanches(0)
+{
+  Reset();
+  fgInstance = this;
+  fMessenger = new FPSiPMDigitizerMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSiPMDigitizer::~FPSiPMDigitizer()
+{
+  if (fgInstance == this) fgInstance = nullptr;
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::Merge(const G4VAccumulable& other)
+{
+  const FPSiPMDigitizer& digitizer = static_cast<const FPSiPMDigitizer&>(other);
+  for (std::size_t channel = 0; channel < digitizer.fChannelStats.size(); channel++) {
+    const ChannelStats& stats = digitizer.fChannelStats[channel];
+    ChannelStats& merged = GetChannelStats(channel);
+    merged.charge.Merge(stats.charge);
+    merged.amplitude.Merge(stats.amplitude);
+    merged.time.Merge(stats.time);
+  }
+  for (G4int type = 0; type < kNTypes; type++) fTypeCounts[type] += digitizer.fTypeCounts[type];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::Reset()
+{
+  fChannelStats.clear();
+  for (auto& count : fTypeCounts) count = 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSiPMDigitizer::ChannelStats& FPSiPMDigitizer::GetChannelStats(G4int channel)
+{
+  std::size_t index = std::max(channel, 0);
+  if (index >= fChannelStats.size()) fChannelStats.resize(index + 1);
+  return fChannelStats[index];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::BeginOfRun()
+{
+  if (!fEnabled) return;
+
+  G4LogicalVolume* sipmLV = G4LogicalVolumeStore::GetInstance()->GetVolume("sipmLV", false);
+  G4Box* sipmBox = sipmLV ? dynamic_cast<G4Box*>(sipmLV->GetSolid()) : nullptr;
+  if (!sipmBox) {
+    G4Exception("FPSiPMDigitizer::BeginOfRun()", "FPSiPM001", JustWarning,
+		"No sipmLV box found, SiPM digitization disabled");
+    fEnabled = false;
+    return;
+  }
+
+  // Microcells over the face of the SiPM, which looks along x
+  fHalfY = sipmBox->GetYHalfLength();
+  fHalfZ = sipmBox->GetZHalfLength();
+  fNCellsY = std::max((G4int) (2.*fHalfY/fCellPitch), 1);
+  fNCellsZ = std::max((G4int) (2.*fHalfZ/fCellPitch), 1);
+  fCellLastTime.assign(fNCellsY*fNCellsZ, 0.);
+  fCellEvent.assign(fNCellsY*fNCellsZ, 0);
+  fEventStamp = 0;
+
+  // Pulse of one avalanche: difference of exponentials normalized to a peak
+  // of 1, sampled over five fall times
+  G4int nPulse = std::max((G4int) (5.*fFallTime/fSampling), 1);
+  fPulse.resize(nPulse);
+  G4double peak = 0.;
+  for (G4int i = 0; i < nPulse; i++) {
+    G4double t = i*fSampling;
+    fPulse[i] = std::exp(-t/fFallTime) - std::exp(-t/fRiseTime);
+    peak = std::max(peak, fPulse[i]);
+  }
+  fPulseIntegral = 0.;
+  for (auto& value : fPulse) {
+    value /= peak;
+    fPulseIntegral += value;
+  }
+
+  G4int nSamples = std::max((G4int) (fGate/fSampling), 1);
+  fCharges.assign(nSamples, 0.);
+  fWaveform.assign(nSamples, 0.);
+  fQueue.clear();
+  fQueue.reserve(1024);
+
+  G4cout << " SiPM digitization: " << fNCellsY << "x" << fNCellsZ << " microcells, "
+	 << nSamples << " samples of " << G4BestUnit(fSampling, "Time") << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline void FPSiPMDigitizer::Push(G4double time, G4int cell, G4int type)
+{
+  fQueue.push_back({ time, cell, type });
+  std::push_heap(fQueue.begin(), fQueue.end(), std::greater<Avalanche>());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPSiPMDigitizer::RandomNeighbour(G4int cell) const
+{
+  G4int iy = cell % fNCellsY;
+  G4int iz = cell / fNCellsY;
+  switch ((G4int) (4.*G4UniformRand())) {
+    case 0:  iy--; break;
+    case 1:  iy++; break;
+    case 2:  iz--; break;
+    default: iz++; break;
+  }
+  if (iy < 0 || iy >= fNCellsY || iz < 0 || iz >= fNCellsZ) return -1;
+  return iz*fNCellsY + iy;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::Digitize(const SiPMHitCollection* hits, G4int channel)
+{
+  if (!fEnabled || fCharges.empty()) return;
+
+  // A new stamp marks every microcell as recovered
+  if (++fEventStamp == 0) {
+    std::fill(fCellEvent.begin(), fCellEvent.end(), 0);
+    fEventStamp = 1;
+  }
+  std::fill(fCharges.begin(), fCharges.end(), 0.);
+  fQueue.clear();
+  fNAvalanches = 0;
+
+  G4int nCells = fNCellsY*fNCellsZ;
+  std::size_t nHits = hits ? hits->entries() : 0;
+  for (std::size_t i = 0; i < nHits; i++) {
+    const SiPMHit* hit = (*hits)[i];
+    if (channel >= 0 && hit->GetChannel() != channel) continue;
+    if (G4UniformRand() > fPDE) continue;
+    G4int iy = (G4int) ((hit->GetLocalPosition().y() + fHalfY)/fCellPitch);
+    G4int iz = (G4int) ((hit->GetLocalPosition().z() + fHalfZ)/fCellPitch);
+    iy = std::min(std::max(iy, 0), fNCellsY - 1);
+    iz = std::min(std::max(iz, 0), fNCellsZ - 1);
+    Push(hit->GetTime(), iz*fNCellsY + iy, kPhoton);
+  }
+
+  G4long nDark = G4Poisson(fDarkRate*fGate);
+  for (G4long i = 0; i < nDark; i++) {
+    Push(G4UniformRand()*fGate, std::min((G4int) (G4UniformRand()*nCells), nCells - 1), kDark);
+  }
+
+  // Avalanches in time order; crosstalk and afterpulses join the queue
+  G4double invSampling = 1./fSampling;
+  G4int nSamples = fCharges.size();
+  while (!fQueue.empty()) {
+    std::pop_heap(fQueue.begin(), fQueue.end(), std::greater<Avalanche>());
+    Avalanche avalanche = fQueue.back();
+    fQueue.pop_back();
+    if (avalanche.time < 0. || avalanche.time >= fGate) continue;
+
+    // Partial charge of a cell not recovered from its last avalanche
+    G4int cell = avalanche.cell;
+    G4double charge = 1.;
+    if (fCellEvent[cell] == fEventStamp) {
+      charge = 1. - std::exp(-(avalanche.time - fCellLastTime[cell])/fRecoveryTime);
+    }
+    fCellEvent[cell] = fEventStamp;
+    fCellLastTime[cell] = avalanche.time;
+    if (fGainSpread > 0.) charge *= 1. + fGainSpread*G4RandGauss::shoot();
+    if (charge <= 0.) continue;
+
+    fNAvalanches++;
+    fTypeCounts[avalanche.type]++;
+
+    // Charge shared between the two nearest samples
+    G4double position = avalanche.time*invSampling;
+    G4int sample = (G4int) position;
+    if (sample >= nSamples) continue;
+    G4double fraction = position - sample;
+    fCharges[sample] += charge*(1. - fraction);
+    if (sample + 1 < nSamples) fCharges[sample + 1] += charge*fraction;
+
+    if (fCrosstalk > 0. && G4UniformRand() < fCrosstalk) {
+      G4int neighbour = RandomNeighbour(cell);
+      if (neighbour >= 0) Push(avalanche.time, neighbour, kCrosstalk);
+    }
+    if (fAfterpulse > 0. && G4UniformRand() < fAfterpulse*charge) {
+      Push(avalanche.time + G4RandExponential::shoot(fAfterpulseTime), cell, kAfterpulse);
+    }
+  }
+
+  BuildWaveform();
+  ExtractFeatures(channel);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::BuildWaveform()
+{
+  // Sparse convolution of the sample charges with the pulse: the inner loop
+  // is a contiguous multiply-add that the compiler vectorizes
+  std::fill(fWaveform.begin(), fWaveform.end(), 0.);
+  G4int nSamples = fWaveform.size();
+  G4int nPulse = fPulse.size();
+  const G4double* pulse = fPulse.data();
+  for (G4int i = 0; i < nSamples; i++) {
+    G4double charge = fCharges[i];
+    if (charge == 0.) continue;
+    G4double* out = fWaveform.data() + i;
+    G4int n = std::min(nPulse, nSamples - i);
+    for (G4int k = 0; k < n; k++) out[k] += charge*pulse[k];
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::ExtractFeatures(G4int channel)
+{
+  G4double sum = 0.;
+  fAmplitude = 0.;
+  fTime = -1.;
+  G4int nSamples = fWaveform.size();
+  for (G4int i = 0; i < nSamples; i++) {
+    G4double value = fWaveform[i];
+    sum += value;
+    if (value > fAmplitude) fAmplitude = value;
+    if (fTime < 0. && value >= fThreshold) {
+      // Linear interpolation of the threshold crossing
+      G4double previous = (i > 0) ? fWaveform[i - 1] : 0.;
+      G4double fraction = (value > previous) ? (fThreshold - previous)/(value - previous) : 0.;
+      fTime = (i - 1 + fraction)*fSampling;
+      if (i == 0) fTime = 0.;
+    }
+  }
+  // Charge in the gate, in units of the single avalanche charge
+  fCharge = sum/fPulseIntegral;
+
+  // Each panel of a stack has its own SiPM: its statistics are its own
+  ChannelStats& stats = GetChannelStats(channel);
+  stats.charge.Fill(fCharge);
+  stats.amplitude.Fill(fAmplitude);
+  if (fTime >= 0.) stats.time.Fill(fTime);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::Print() const
+{
+  if (!fEnabled || fChannelStats.empty()) return;
+
+  FPPrecisionGuard precisionGuard(4);
+  G4cout << G4endl << " SiPM digitization:" << G4endl;
+  for (std::size_t channel = 0; channel < fChannelStats.size(); channel++) {
+    const ChannelStats& stats = fChannelStats[channel];
+    if (stats.charge.GetN() == 0) continue;
+    if (fChannelStats.size() > 1) G4cout << "   channel " << channel << G4endl;
+    G4cout << "   events      : " << stats.charge.GetN() << G4endl
+	   << "   charge      : " << stats.charge.GetMean() << " +- " << stats.charge.GetError()
+	   << " p.e. (rms " << stats.charge.GetRMS() << ")" << G4endl
+	   << "   amplitude   : " << stats.amplitude.GetMean() << " +- "
+	   << stats.amplitude.GetError() << " p.e." << G4endl
+	   << "   time        : " << G4BestUnit(stats.time.GetMean(), "Time") << " (rms "
+	   << G4BestUnit(stats.time.GetRMS(), "Time") << ", " << stats.time.GetN()
+	   << " events above " << fThreshold << " p.e.)" << G4endl;
+  }
+  G4cout << "   avalanches  :";
+  for (G4int type = 0; type < kNTypes; type++) {
+    G4cout << " " << fTypeCounts[type] << " " << avalancheNames[type]
+	   << (type + 1 < kNTypes ? "," : "");
+  }
+  G4cout << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::Save(std::ostream& out) const
+{
+  std::uint32_t nChannels = fChannelStats.size();
+  out.write(reinterpret_cast<const char*>(&nChannels), sizeof(nChannels));
+  out.write(reinterpret_cast<const char*>(fChannelStats.data()), nChannels*sizeof(ChannelStats));
+  out.write(reinterpret_cast<const char*>(fTypeCounts), sizeof(fTypeCounts));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizer::Restore(std::istream& in)
+{
+  std::uint32_t nChannels;
+  if (!in.read(reinterpret_cast<char*>(&nChannels), sizeof(nChannels))) return;
+  std::vector<ChannelStats> saved(nChannels);
+  G4long counts[kNTypes];
+  if (!in.read(reinterpret_cast<char*>(saved.data()), nChannels*sizeof(ChannelStats))
+      || !in.read(reinterpret_cast<char*>(counts), sizeof(counts))) return;
+  for (std::uint32_t channel = 0; channel < nChannels; channel++) {
+    ChannelStats& stats = GetChannelStats(channel);
+    stats.charge.Merge(saved[channel].charge);
+    stats.amplitude.Merge(saved[channel].amplitude);
+    stats.time.Merge(saved[channel].time);
+  }
+  for (G4int type = 0; type < kNTypes; type++) fTypeCounts[type] += counts[type];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,219 @@
+/// October 19, 2026: SiPM digitization messenger.
+///
+///    /FP/sipm/enable         : digitize the SiPM hits at the end of each event
+///    /FP/sipm/pde            : photon detection efficiency
+///    /FP/sipm/cellPitch      : pitch of the microcells
+///    /FP/sipm/recoveryTime   : recovery time constant of a microcell
+///    /FP/sipm/crosstalk      : optical crosstalk probability per avalanche
+///    /FP/sipm/afterpulse     : afterpulse probability per avalanche
+///    /FP/sipm/afterpulseTime : mean delay of the afterpulses
+///    /FP/sipm/darkRate       : dark count rate of the device
+///    /FP/sipm/gainSpread     : relative spread of the avalanche charge
+///    /FP/sipm/riseTime       : rise time constant of the pulse
+///    /FP/sipm/fallTime       : fall time constant of the pulse
+///    /FP/sipm/sampling       : sampling period of the waveform
+///    /FP/sipm/gate           : length of the gate, starting at time 0
+///    /FP/sipm/threshold      : leading edge threshold (p.e.)
+
+#include "globals.hh"
+
+#include "FPSiPMDigitizerMessenger.hh"
+
+#include "FPSiPMDigitizer.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSiPMDigitizerMessenger::FPSiPMDigitizerMessenger(FPSiPMDigitizer* FPDigi)
+:FPDigitizer(FPDigi)
+{
+  sipmDir = new G4UIdirectory("/FP/sipm/");
+  sipmDir->SetGuidance("SiPM digitization:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/sipm/enable", this);
+  SetEnableCmd->SetGuidance("Digitize the SiPM hits at the end of each event");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetPDECmd = new G4UIcmdWithADouble("/FP/sipm/pde", this);
+  SetPDECmd->SetGuidance("Photon detection efficiency");
+  SetPDECmd->SetParameterName("pde", false);
+  SetPDECmd->SetRange("pde >= 0. && pde <= 1.");
+  SetPDECmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetCellPitchCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/cellPitch", this);
+  SetCellPitchCmd->SetGuidance("Pitch of the microcells");
+  SetCellPitchCmd->SetParameterName("pitch", false);
+  SetCellPitchCmd->SetRange("pitch > 0.");
+  SetCellPitchCmd->SetUnitCategory("Length");
+  SetCellPitchCmd->SetDefaultUnit("um");
+  SetCellPitchCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetRecoveryTimeCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/recoveryTime", this);
+  SetRecoveryTimeCmd->SetGuidance("Recovery time constant of a microcell");
+  SetRecoveryTimeCmd->SetParameterName("tau", false);
+  SetRecoveryTimeCmd->SetRange("tau > 0.");
+  SetRecoveryTimeCmd->SetUnitCategory("Time");
+  SetRecoveryTimeCmd->SetDefaultUnit("ns");
+  SetRecoveryTimeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetCrosstalkCmd = new G4UIcmdWithADouble("/FP/sipm/crosstalk", this);
+  SetCrosstalkCmd->SetGuidance("Optical crosstalk probability per avalanche");
+  SetCrosstalkCmd->SetParameterName("probability", false);
+  SetCrosstalkCmd->SetRange("probability >= 0. && probability < 1.");
+  SetCrosstalkCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetAfterpulseCmd = new G4UIcmdWithADouble("/FP/sipm/afterpulse", this);
+  SetAfterpulseCmd->SetGuidance("Afterpulse probability per avalanche");
+  SetAfterpulseCmd->SetParameterName("probability", false);
+  SetAfterpulseCmd->SetRange("probability >= 0. && probability < 1.");
+  SetAfterpulseCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetAfterpulseTimeCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/afterpulseTime", this);
+  SetAfterpulseTimeCmd->SetGuidance("Mean delay of the afterpulses");
+  SetAfterpulseTimeCmd->SetParameterName("tau", false);
+  SetAfterpulseTimeCmd->SetRange("tau > 0.");
+  SetAfterpulseTimeCmd->SetUnitCategory("Time");
+  SetAfterpulseTimeCmd->SetDefaultUnit("ns");
+  SetAfterpulseTimeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetDarkRateCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/darkRate", this);
+  SetDarkRateCmd->SetGuidance("Dark count rate of the device");
+  SetDarkRateCmd->SetParameterName("rate", false);
+  SetDarkRateCmd->SetRange("rate >= 0.");
+  SetDarkRateCmd->SetUnitCategory("Frequency");
+  SetDarkRateCmd->SetDefaultUnit("kHz");
+  SetDarkRateCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetGainSpreadCmd = new G4UIcmdWithADouble("/FP/sipm/gainSpread", this);
+  SetGainSpreadCmd->SetGuidance("Relative spread of the avalanche charge");
+  SetGainSpreadCmd->SetParameterName("spread", false);
+  SetGainSpreadCmd->SetRange("spread >= 0.");
+  SetGainSpreadCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetRiseTimeCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/riseTime", this);
+  SetRiseTimeCmd->SetGuidance("Rise time constant of the pulse");
+  SetRiseTimeCmd->SetParameterName("tau", false);
+  SetRiseTimeCmd->SetRange("tau > 0.");
+  SetRiseTimeCmd->SetUnitCategory("Time");
+  SetRiseTimeCmd->SetDefaultUnit("ns");
+  SetRiseTimeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetFallTimeCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/fallTime", this);
+  SetFallTimeCmd->SetGuidance("Fall time constant of the pulse");
+  SetFallTimeCmd->SetParameterName("tau", false);
+  SetFallTimeCmd->SetRange("tau > 0.");
+  SetFallTimeCmd->SetUnitCategory("Time");
+  SetFallTimeCmd->SetDefaultUnit("ns");
+  SetFallTimeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetSamplingCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/sampling", this);
+  SetSamplingCmd->SetGuidance("Sampling period of the waveform");
+  SetSamplingCmd->SetParameterName("period", false);
+  SetSamplingCmd->SetRange("period > 0.");
+  SetSamplingCmd->SetUnitCategory("Time");
+  SetSamplingCmd->SetDefaultUnit("ns");
+  SetSamplingCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetGateCmd = new G4UIcmdWithADoubleAndUnit("/FP/sipm/gate", this);
+  SetGateCmd->SetGuidance("Length of the gate, starting at time 0");
+  SetGateCmd->SetParameterName("gate", false);
+  SetGateCmd->SetRange("gate > 0.");
+  SetGateCmd->SetUnitCategory("Time");
+  SetGateCmd->SetDefaultUnit("ns");
+  SetGateCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetThresholdCmd = new G4UIcmdWithADouble("/FP/sipm/threshold", this);
+  SetThresholdCmd->SetGuidance("Leading edge threshold (p.e.)");
+  SetThresholdCmd->SetParameterName("threshold", false);
+  SetThresholdCmd->SetRange("threshold > 0.");
+  SetThresholdCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSiPMDigitizerMessenger::~FPSiPMDigitizerMessenger()
+{
+  delete SetEnableCmd;
+  delete SetPDECmd;
+  delete SetCellPitchCmd;
+  delete SetRecoveryTimeCmd;
+  delete SetCrosstalkCmd;
+  delete SetAfterpulseCmd;
+  delete SetAfterpulseTimeCmd;
+  delete SetDarkRateCmd;
+  delete SetGainSpreadCmd;
+  delete SetRiseTimeCmd;
+  delete SetFallTimeCmd;
+  delete SetSamplingCmd;
+  delete SetGateCmd;
+  delete SetThresholdCmd;
+  delete sipmDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSiPMDigitizerMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPDigitizer->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetPDECmd ) {
+      FPDigitizer->SetPDE(SetPDECmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetCellPitchCmd ) {
+      FPDigitizer->SetCellPitch(SetCellPitchCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetRecoveryTimeCmd ) {
+      FPDigitizer->SetRecoveryTime(SetRecoveryTimeCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetCrosstalkCmd ) {
+      FPDigitizer->SetCrosstalk(SetCrosstalkCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetAfterpulseCmd ) {
+      FPDigitizer->SetAfterpulse(SetAfterpulseCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetAfterpulseTimeCmd ) {
+      FPDigitizer->SetAfterpulseTime(SetAfterpulseTimeCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetDarkRateCmd ) {
+      FPDigitizer->SetDarkRate(SetDarkRateCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetGainSpreadCmd ) {
+      FPDigitizer->SetGainSpread(SetGainSpreadCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetRiseTimeCmd ) {
+      FPDigitizer->SetRiseTime(SetRiseTimeCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetFallTimeCmd ) {
+      FPDigitizer->SetFallTime(SetFallTimeCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetSamplingCmd ) {
+      FPDigitizer->SetSampling(SetSamplingCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetGateCmd ) {
+      FPDigitizer->SetGate(SetGateCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetThresholdCmd ) {
+      FPDigitizer->SetThreshold(SetThresholdCmd->GetNewDoubleValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
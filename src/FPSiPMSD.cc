@@ -3,14 +3,27 @@
 ///
 /// Implementation of the SiPM sensitive detector
 ///
+/// October 19, 2026: Record the origin of the detected photons in the spatial maps.
+///                   Mark the photon as detected for the fate accounting.
+///                   Store the arrival time and position of the photon, for the digitization,
+///                   and its energy and channel, for the raw hit stream.
+///                   The channel is the panel number, copy number of the module holding the SiPM.
+///                   Hits outside the readout time gate are dropped.
+///                   The hit keeps the weight of the photon.
+///
 
 #include "FPSiPMSD.hh"
 #include "SiPMhit.hh"
+#include "FPTrackInformation.hh"
+#include "FPSpatialMaps.hh"
+#include "FPPhotonFates.hh"
+#include "FPTimeGate.hh"
 
 #include "G4Step.hh"
 #include "G4HCofThisEvent.hh"
 #include "G4HCtable.hh"
 #include "G4SDManager.hh"
+#include "G4NavigationHistory.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -39,12 +52,26 @@ G4bool FPSiPMSD::ProcessHits(G4Step *step, G4TouchableHistory *)
 
   auto preStepPoint = step->GetPreStepPoint();
   auto touchable = preStepPoint->GetTouchable();
-  auto copyNo = touchable->GetVolume()->GetCopyNo();
+  auto copyNo = touchable->GetCopyNumber(1);      // panel module
   auto hitTime = preStepPoint->GetGlobalTime();
+
+  // Outside the integration window of the readout
+  FPTimeGate* gate = FPTimeGate::Instance();
+  if (gate && gate->IsEnabled() && !gate->Contains(hitTime)) {
+    gate->AddDroppedHit();
+    return false;
+  }
   
   //  auto hit = new B5HodoscopeHit(copyNo,hitTime);
   auto hit = new SiPMHit();
   hit->AddPhotonCount();
+  hit->SetTime(hitTime);
+  hit->SetEnergy(preStepPoint->GetKineticEnergy());
+  hit->SetChannel(copyNo);
+  hit->SetWeight(step->GetTrack()->GetWeight());
+  hit->SetPosition(preStepPoint->GetPosition());
+  hit->SetLocalPosition(touchable->GetHistory()->GetTopTransform()
+			.TransformPoint(preStepPoint->GetPosition()));
 
   //  auto physical = touchable->GetVolume();
   //  hit->SetLogV(physical->GetLogicalVolume());
@@ -53,6 +80,14 @@ G4bool FPSiPMSD::ProcessHits(G4Step *step, G4TouchableHistory *)
   //  hit->SetRot(transform.NetRotation());
   //  hit->SetPos(transform.NetTranslation());
   photonHitCollection->insert(hit);
+
+  // Where the light of this photon was produced; count it only once
+  auto info = static_cast<FPTrackInformation*>(step->GetTrack()->GetUserInformation());
+  if (info && info->GetFate() != FPPhotonFates::kDetected) {
+    info->SetFate(FPPhotonFates::kDetected);
+    FPSpatialMaps* maps = FPSpatialMaps::Instance();
+    if (maps && maps->IsEnabled()) maps->AddDetectedPhoton(info->GetOrigin());
+  }
   
   return true;
 }
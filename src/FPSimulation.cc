@@ -0,0 +1,212 @@
+/// October 19, 2026: In-process simulation API.
+
+#include "FPSimulation.hh"
+#include "FPDetectorConstruction.hh"
+#include "FPActionInitialization.hh"
+#include "FPOpticalControl.hh"
+#include "FPOpticalPhysics.hh"
+#include "FPFastSimulationPhysics.hh"
+#include "FPMTRunManager.hh"
+
+#include "G4RunManager.hh"
+#include "G4UImanager.hh"
+#include "G4PhysListFactory.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSimulation::FPSimulation(G4int nThreads)
+  : fRunManager(nullptr),
+    fDetector(nullptr),
+    fInitialized(false)
+{
+  if (G4RunManager::GetRunManager()) {
+    G4Exception("FPSimulation::FPSimulation()", "FPSim001", FatalException,
+		"A run manager already exists: one simulation per process.");
+  }
+
+  G4Random::setTheEngine(new CLHEP::RanecuEngine);
+
+  if (nThreads > 0) {
+    FPMTRunManager* mtRunManager = new FPMTRunManager;
+    mtRunManager->SetNumberOfThreads(nThreads);
+    fRunManager = mtRunManager;
+  } else {
+    fRunManager = new G4RunManager;
+  }
+
+  fDetector = new FPDetectorConstruction;
+  fRunManager->SetUserInitialization(fDetector);
+  fRunManager->SetUserInitialization(CreatePhysicsList());
+  fRunManager->SetUserInitialization(new FPActionInitialization());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSimulation::~FPSimulation()
+{
+  delete fRunManager;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4VModularPhysicsList* FPSimulation::CreatePhysicsList()
+{
+  // Need to add code for activating optical physics processes
+  // We simply took the code from the loopPanel processes configuration 
+  G4PhysListFactory factory;
+  G4VModularPhysicsList* phys = NULL;
+  G4String physName = "";
+  char* path = getenv("PHYSLIST");
+  if (path) {
+      physName = G4String(path);
+  } else {
+      physName = "FTFP_BERT"; // default
+  }
+  // reference PhysicsList via its name
+  if (factory.IsReferencePhysList(physName)) {
+      phys = factory.GetReferencePhysList(physName);
+  }
+  //
+  // Now add and configure optical physics
+  //
+  // (with the fast path for the constant-index boundaries, see FPOpBoundaryProcess)
+  G4OpticalPhysics* opticalPhysics = new FPOpticalPhysics();
+  /* These were commented out on 7/17/2024. 
+  //opticalPhysics->Configure(kCerenkov, true);
+  //opticalPhysics->SetCerenkovStackPhotons(false);
+  opticalPhysics->Configure(kScintillation, true);  
+  opticalPhysics->Configure(kAbsorption, true); 
+  opticalPhysics->Configure(kBoundary, true);      
+  opticalPhysics->Configure(kWLS, true);
+
+  // Set control parameters for scintillation
+  // Followed from: 
+  // https://indico.cern.ch/event/789510/contributions/3279418/attachments/1818134/2972494/AH_OpticalPhotons_slides.pdf
+  opticalPhysics->SetScintillationYieldFactor(1.0);
+  opticalPhysics->SetScintillationExcitationRatio(0.0);
+
+  opticalPhysics->SetMaxNumPhotonsPerStep(100);
+  opticalPhysics->SetMaxBetaChangePerStep(10.0);
+  */
+  
+  phys->RegisterPhysics(opticalPhysics);
+
+  // GEANT4 11 configures the optical processes through G4OpticalParameters:
+  // its settings are tuned at run time with the /FP/optical/ commands
+  FPOpticalControl::Instance();
+
+  // Fast simulation for optical photons: constructed only if the WLS fiber
+  // model is enabled
+  phys->RegisterPhysics(new FPFastSimulationPhysics());
+  phys->DumpList();
+
+  return phys;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPSimulation::ApplyCommand(const G4String& command)
+{
+  return G4UImanager::GetUIpointer()->ApplyCommand(command);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSimulation::Initialize()
+{
+  if (fInitialized) return;
+  fRunManager->Initialize();
+  fInitialized = true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSimulation::SetNumberOfPanels(G4int n)
+{
+  fDetector->SetNumberOfPanels(n);
+  GeometryModified();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSimulation::SetPanelSpacing(G4double spacing)
+{
+  fDetector->SetPanelSpacing(spacing);
+  GeometryModified();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSimulation::SetPanelThickness(G4double thickness)
+{
+  fDetector->SetPanelThickness(thickness);
+  GeometryModified();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSimulation::SetFiberOffset(G4int panel, G4double offset)
+{
+  fDetector->SetFiberOffset(panel, offset);
+  GeometryModified();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSimulation::GeometryModified()
+{
+  // Before the initialization the geometry is built with the new values anyway
+  if (fInitialized) fDetector->RebuildGeometry();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSimulation::SetSource(G4int particleType, const G4ThreeVector& position)
+{
+  // The generators belong to the threads: through the (broadcast) commands
+  std::ostringstream type;
+  type << "/FP/gun/particleType " << particleType;
+  ApplyCommand(type.str());
+
+  std::ostringstream gunPosition;
+  gunPosition << "/FP/gun/position " << position.x()/mm << " " << position.y()/mm
+	      << " " << position.z()/mm << " mm";
+  ApplyCommand(gunPosition.str());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPRunResults FPSimulation::Run(G4int nEvents)
+{
+  Initialize();
+
+  auto start = std::chrono::steady_clock::now();
+  fRunManager->BeamOn(nEvents);
+  auto stop = std::chrono::steady_clock::now();
+
+  FPRunResults results;
+  results.seconds = std::chrono::duration<G4double>(stop - start).count();
+
+  // The master run action holds the merged statistics and histograms
+  auto runAction = dynamic_cast<const FPRunAction*>(fRunManager->GetUserRunAction());
+  if (!runAction) return results;
+
+  const FPWelford& lightYield = runAction->GetLightYield();
+  results.nEvents            = runAction->GetELoss().GetN();
+  results.nEventsWithPhotons = runAction->GetEventsWithPhotons();
+  results.lightYield         = lightYield.GetMean();
+  results.lightYieldError    = lightYield.GetError();
+  results.lightYieldRMS      = lightYield.GetRMS();
+  results.eLoss              = runAction->GetELoss().GetMean();
+  results.eLossError         = runAction->GetELoss().GetError();
+  results.histograms         = runAction->GetHistograms();
+  return results;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
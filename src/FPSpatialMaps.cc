@@ -0,0 +1,241 @@
+/// October 19, 2026: Spatial maps of the light production and energy loss.
+///
+///    Output file (little endian, written by the master at the end of run):
+///      char[8]   "FPMAPS1"
+///      int32     nx, ny, nz
+///      double    half sizes of the panel box (mm)
+///      double    eLoss per component (MeV), FPVolumeComponents::kNComponents values
+///      double    edep[nx*ny*nz] (MeV), then scintillation photons, then
+///                detected photon origins; x runs fastest, global coordinates.
+
+#include "FPSpatialMaps.hh"
+#include "FPSpatialMapsMessenger.hh"
+#include "FPStepConsumer.hh"
+
+#include "G4Step.hh"
+#include "G4Box.hh"
+#include "G4LogicalVolume.hh"
+#include "G4LogicalVolumeStore.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UnitsTable.hh"
+
+#include <algorithm>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <iomanip>
+
+G4ThreadLocal FPSpatialMaps* FPSpatialMaps::fgInstance = nullptr;
+
+namespace {
+
+  // Energy deposit of all particles but optical photons
+  class FPSpatialMapsConsumer : public FPStepConsumer
+  {
+  public:
+    FPSpatialMapsConsumer(FPSpatialMaps* maps)
+      : FPStepConsumer(false, true, true), fMaps(maps) {}
+
+    virtual G4bool IsActive() const { return fMaps->IsEnabled(); }
+
+    virtual void ProcessStep(const G4Step* step, const G4LogicalVolume* volume)
+    {
+      G4double edep = step->GetTotalEnergyDeposit();
+      if (edep <= 0.) return;
+      // Deposit at a random point of the step would be finer; the midpoint is enough here
+      G4ThreeVector position = 0.5*(step->GetPreStepPoint()->GetPosition()
+				    + step->GetPostStepPoint()->GetPosition());
+      fMaps->AddEnergyDeposit(position, edep, volume);
+    }
+
+  private:
+    FPSpatialMaps* fMaps;
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSpatialMaps::FPSpatialMaps()
+  : G4VAccumulable("SpatialMaps"),
+    fEnabled(false),
+    fNx(50), fNy(50), fNz(1),
+    fFileName("fiberPanelMaps.bin")
+{
+  for (auto& eLoss : fComponentELoss) eLoss = 0.;
+  fgInstance = this;
+  fMessenger = new FPSpatialMapsMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSpatialMaps::~FPSpatialMaps()
+{
+  if (fgInstance == this) fgInstance = nullptr;
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPStepConsumer* FPSpatialMaps::CreateStepConsumer()
+{
+  return new FPSpatialMapsConsumer(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSpatialMaps::BeginOfRun()
+{
+  if (!fEnabled) return;
+
+  G4LogicalVolumeStore* store = G4LogicalVolumeStore::GetInstance();
+  G4LogicalVolume* panelLV = store->GetVolume("PanelLV", false);
+  G4Box* panelBox = panelLV ? dynamic_cast<G4Box*>(panelLV->GetSolid()) : nullptr;
+  if (!panelBox) {
+    G4Exception("FPSpatialMaps::BeginOfRun()", "FPMaps001", JustWarning,
+		"No PanelLV box found, spatial maps disabled");
+    fEnabled = false;
+    return;
+  }
+
+  // The panel (panel 0 of a stack) is placed at the origin of the world
+  fHalfSize = G4ThreeVector(panelBox->GetXHalfLength(), panelBox->GetYHalfLength(),
+			    panelBox->GetZHalfLength());
+  fInvVoxelSize = G4ThreeVector(0.5*fNx/fHalfSize.x(), 0.5*fNy/fHalfSize.y(),
+				0.5*fNz/fHalfSize.z());
+
+  fComponents.Build();
+
+  std::size_t nVoxels = (std::size_t) fNx*fNy*fNz;
+  fEdep.assign(nVoxels, 0.);
+  fScintPhotons.assign(nVoxels, 0.);
+  fDetectedOrigins.assign(nVoxels, 0.);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSpatialMaps::Merge(const G4VAccumulable& other)
+{
+  const FPSpatialMaps& maps = static_cast<const FPSpatialMaps&>(other);
+  if (!maps.fEnabled || maps.fEdep.size() != fEdep.size()) return;
+
+  for (std::size_t i = 0; i < fEdep.size(); i++) {
+    fEdep[i]            += maps.fEdep[i];
+    fScintPhotons[i]    += maps.fScintPhotons[i];
+    fDetectedOrigins[i] += maps.fDetectedOrigins[i];
+  }
+  for (G4int component = 0; component < FPVolumeComponents::kNComponents; component++) {
+    fComponentELoss[component] += maps.fComponentELoss[component];
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSpatialMaps::Reset()
+{
+  std::fill(fEdep.begin(), fEdep.end(), 0.);
+  std::fill(fScintPhotons.begin(), fScintPhotons.end(), 0.);
+  std::fill(fDetectedOrigins.begin(), fDetectedOrigins.end(), 0.);
+  for (auto& eLoss : fComponentELoss) eLoss = 0.;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSpatialMaps::Write() const
+{
+  if (!fEnabled) return;
+
+  std::ofstream out(fFileName, std::ios::binary);
+  if (!out) {
+    G4ExceptionDescription msg;
+    msg << "Can not write spatial maps to " << fFileName;
+    G4Exception("FPSpatialMaps::Write()", "FPMaps002", JustWarning, msg);
+    return;
+  }
+
+  const char magic[8] = "FPMAPS1";
+  G4int bins[3] = { fNx, fNy, fNz };
+  G4double halfSize[3] = { fHalfSize.x()/mm, fHalfSize.y()/mm, fHalfSize.z()/mm };
+  G4double eLoss[FPVolumeComponents::kNComponents];
+  for (G4int component = 0; component < FPVolumeComponents::kNComponents; component++) {
+    eLoss[component] = fComponentELoss[component]/MeV;
+  }
+  std::size_t bytes = fEdep.size()*sizeof(G4double);
+
+  out.write(magic, sizeof(magic));
+  out.write(reinterpret_cast<const char*>(bins), sizeof(bins));
+  out.write(reinterpret_cast<const char*>(halfSize), sizeof(halfSize));
+  out.write(reinterpret_cast<const char*>(eLoss), sizeof(eLoss));
+  out.write(reinterpret_cast<const char*>(fEdep.data()), bytes);
+  out.write(reinterpret_cast<const char*>(fScintPhotons.data()), bytes);
+  out.write(reinterpret_cast<const char*>(fDetectedOrigins.data()), bytes);
+
+  G4cout << G4endl << " Energy loss per component:" << G4endl;
+  for (G4int component = 0; component < FPVolumeComponents::kNComponents; component++) {
+    G4cout << "   " << std::setw(10) << FPVolumeComponents::GetName(component) << " : "
+	   << G4BestUnit(fComponentELoss[component], "Energy") << G4endl;
+  }
+  G4cout << " Spatial maps (" << fNx << "x" << fNy << "x" << fNz
+	 << " voxels) written to " << fFileName << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSpatialMaps::Save(std::ostream& out) const
+{
+  G4int bins[3] = { fNx, fNy, fNz };
+  G4double halfSize[3] = { fHalfSize.x(), fHalfSize.y(), fHalfSize.z() };
+  uint64_t nVoxels = fEdep.size();
+  std::size_t bytes = fEdep.size()*sizeof(G4double);
+  out.write(reinterpret_cast<const char*>(bins), sizeof(bins));
+  out.write(reinterpret_cast<const char*>(halfSize), sizeof(halfSize));
+  out.write(reinterpret_cast<const char*>(&nVoxels), sizeof(nVoxels));
+  out.write(reinterpret_cast<const char*>(fComponentELoss), sizeof(fComponentELoss));
+  out.write(reinterpret_cast<const char*>(fEdep.data()), bytes);
+  out.write(reinterpret_cast<const char*>(fScintPhotons.data()), bytes);
+  out.write(reinterpret_cast<const char*>(fDetectedOrigins.data()), bytes);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSpatialMaps::Restore(std::istream& in)
+{
+  G4int bins[3];
+  G4double halfSize[3];
+  uint64_t nVoxels;
+  G4double eLoss[FPVolumeComponents::kNComponents];
+  in.read(reinterpret_cast<char*>(bins), sizeof(bins));
+  in.read(reinterpret_cast<char*>(halfSize), sizeof(halfSize));
+  in.read(reinterpret_cast<char*>(&nVoxels), sizeof(nVoxels));
+  in.read(reinterpret_cast<char*>(eLoss), sizeof(eLoss));
+
+  // Maps never sized by a run (e.g. in fpMerge) take the saved binning
+  if (in && fEdep.empty() && nVoxels == (uint64_t) bins[0]*bins[1]*bins[2]) {
+    fNx = bins[0];
+    fNy = bins[1];
+    fNz = bins[2];
+    fHalfSize = G4ThreeVector(halfSize[0], halfSize[1], halfSize[2]);
+    fInvVoxelSize = G4ThreeVector(0.5*fNx/fHalfSize.x(), 0.5*fNy/fHalfSize.y(),
+				  0.5*fNz/fHalfSize.z());
+    fEdep.assign(nVoxels, 0.);
+    fScintPhotons.assign(nVoxels, 0.);
+    fDetectedOrigins.assign(nVoxels, 0.);
+  }
+  if (!in || nVoxels != fEdep.size() || bins[0] != fNx || bins[1] != fNy || bins[2] != fNz) {
+    G4Exception("FPSpatialMaps::Restore()", "FPMaps003", JustWarning,
+		"Saved spatial maps do not match the current binning, not restored");
+    return;
+  }
+
+  std::vector<G4double> values(nVoxels);
+  std::vector<G4double>* maps[3] = { &fEdep, &fScintPhotons, &fDetectedOrigins };
+  for (auto map : maps) {
+    in.read(reinterpret_cast<char*>(values.data()), nVoxels*sizeof(G4double));
+    for (std::size_t i = 0; i < nVoxels; i++) (*map)[i] += values[i];
+  }
+  for (G4int component = 0; component < FPVolumeComponents::kNComponents; component++) {
+    fComponentELoss[component] += eLoss[component];
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,85 @@
+/// October 19, 2026: Spatial maps messenger.
+///
+///    /FP/maps/enable   : fill the spatial maps
+///    /FP/maps/bins     : number of voxels along x, y and z of the panel
+///    /FP/maps/fileName : output file of the merged maps
+
+#include "globals.hh"
+
+#include "FPSpatialMapsMessenger.hh"
+
+#include "FPSpatialMaps.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+
+#include <sstream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSpatialMapsMessenger::FPSpatialMapsMessenger(FPSpatialMaps* FPMap)
+:FPMaps(FPMap)
+{
+  mapsDir = new G4UIdirectory("/FP/maps/");
+  mapsDir->SetGuidance("Spatial maps of energy deposit and light production:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/maps/enable", this);
+  SetEnableCmd->SetGuidance("Fill the voxel maps over the panel and the eLoss per component");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetBinsCmd = new G4UIcommand("/FP/maps/bins", this);
+  SetBinsCmd->SetGuidance("Number of voxels along x, y and z of the panel");
+  G4UIparameter* nx = new G4UIparameter("nx", 'i', false);
+  nx->SetParameterRange("nx > 0");
+  SetBinsCmd->SetParameter(nx);
+  G4UIparameter* ny = new G4UIparameter("ny", 'i', false);
+  ny->SetParameterRange("ny > 0");
+  SetBinsCmd->SetParameter(ny);
+  G4UIparameter* nz = new G4UIparameter("nz", 'i', true);
+  nz->SetParameterRange("nz > 0");
+  nz->SetDefaultValue(1);
+  SetBinsCmd->SetParameter(nz);
+  SetBinsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetFileNameCmd = new G4UIcmdWithAString("/FP/maps/fileName", this);
+  SetFileNameCmd->SetGuidance("Output file of the merged maps");
+  SetFileNameCmd->SetParameterName("fileName", false);
+  SetFileNameCmd->SetDefaultValue("fiberPanelMaps.bin");
+  SetFileNameCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPSpatialMapsMessenger::~FPSpatialMapsMessenger()
+{
+  delete SetEnableCmd;
+  delete SetBinsCmd;
+  delete SetFileNameCmd;
+  delete mapsDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSpatialMapsMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPMaps->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetBinsCmd ) {
+      G4int nx, ny, nz;
+      std::istringstream is(newValues);
+      is >> nx >> ny >> nz;
+      FPMaps->SetBins(nx, ny, nz);
+    }
+
+    if (command == SetFileNameCmd ) {
+      FPMaps->SetFileName(newValues);
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
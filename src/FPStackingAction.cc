@@ -1,15 +1,34 @@
 /// This code was created based on B3a example
 /// Date created: May 27, 2020
 /// Authors: hexc. Zachary Langford and Nadia Qutob
+///
+/// October 19, 2026: Staged tracking of the optical photons for the coincidence trigger:
+///                   photons wait for the end of the charged particle stage, then each
+///                   stage tracks the photons of one panel, chosen by FPCoincidenceTrigger.
+///                   Once the trigger cannot fire, the photons left are killed.
+/// October 19, 2026: Keep the peak number of stacked tracks.
+/// October 19, 2026: And of the urgent and waiting tracks.
 
 #include "FPStackingAction.hh"
+#include "FPCoincidenceTrigger.hh"
+#include "SiPMhit.hh"
 
 #include "G4Track.hh"
 #include "G4NeutrinoE.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4VTouchable.hh"
+#include "G4StackManager.hh"
+#include "G4EventManager.hh"
+#include "G4Event.hh"
+#include "G4HCofThisEvent.hh"
+#include "G4SDManager.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 FPStackingAction::FPStackingAction()
+  : fPeakStackedTracks(0),
+    fPeakUrgentTracks(0),
+    fPeakWaitingTracks(0)
 { }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -22,12 +41,85 @@ FPStackingAction::~FPStackingAction()
 G4ClassificationOfNewTrack
 FPStackingAction::ClassifyNewTrack(const G4Track* track)
 {
+  G4int nStacked = stackManager->GetNTotalTrack();
+  if (nStacked > fPeakStackedTracks) fPeakStackedTracks = nStacked;
+  G4int nUrgent = stackManager->GetNUrgentTrack();
+  if (nUrgent > fPeakUrgentTracks) fPeakUrgentTracks = nUrgent;
+  G4int nWaiting = stackManager->GetNWaitingTrack();
+  if (nWaiting > fPeakWaitingTracks) fPeakWaitingTracks = nWaiting;
+
   //keep primary particle
   if (track->GetParentID() == 0) return fUrgent;
 
   //kill secondary neutrino
   if (track->GetDefinition() == G4NeutrinoE::NeutrinoE()) return fKill;
-  else return fUrgent;
+
+  // Optical photons of the panel stack, for the coincidence trigger
+  FPCoincidenceTrigger* trigger = FPCoincidenceTrigger::Instance();
+  if (trigger && trigger->IsStaged()
+      && track->GetDefinition() == G4OpticalPhoton::OpticalPhotonDefinition()) {
+    G4int panel = PanelOf(track);
+    if (panel < 0) return fUrgent;
+
+    switch (trigger->GetTrackedPanel()) {
+      case FPCoincidenceTrigger::kCharged:
+	trigger->AddPhoton(panel);
+	return fWaiting;
+      case FPCoincidenceTrigger::kAllPanels:
+	return fUrgent;
+      case FPCoincidenceTrigger::kNoPanel:
+	return fKill;
+      default:
+	return (panel == trigger->GetTrackedPanel()) ? fUrgent : fWaiting;
+    }
+  }
+
+  return fUrgent;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPStackingAction::NewStage()
+{
+  FPCoincidenceTrigger* trigger = FPCoincidenceTrigger::Instance();
+  if (!trigger || !trigger->IsStaged()) return;
+
+  // Hits of the panels tracked so far
+  const G4Event* event = G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  G4HCofThisEvent* HCE = event ? event->GetHCofThisEvent() : nullptr;
+  const SiPMHitCollection* hits = nullptr;
+  if (HCE) {
+    G4int HCID = G4SDManager::GetSDMpointer()->GetCollectionID("SiPMHitCollection");
+    hits = static_cast<const SiPMHitCollection*>(HCE->GetHC(HCID));
+  }
+
+  // The waiting photons are in the urgent stack: keep those of the next panel
+  G4int next = trigger->NextPanel(hits);
+  if (next == FPCoincidenceTrigger::kNoPanel) {
+    trigger->AddKilledPhotons(stackManager->GetNUrgentTrack());
+    stackManager->clear();
+  } else if (next != FPCoincidenceTrigger::kAllPanels) {
+    stackManager->ReClassify();
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPStackingAction::PrepareNewEvent()
+{
+  FPCoincidenceTrigger* trigger = FPCoincidenceTrigger::Instance();
+  if (trigger) trigger->BeginOfEvent();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPStackingAction::PanelOf(const G4Track* track) const
+{
+  // The modules are the daughters of the world
+  const G4VTouchable* touchable = track->GetTouchable();
+  if (!touchable) return -1;
+  G4int depth = touchable->GetHistoryDepth();
+  return (depth > 0) ? touchable->GetCopyNumber(depth - 1) : -1;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -1,7 +1,12 @@
 // Aug 5, 2020: hexc and Zachary
-// 
+//
 // Add stepping action to track energy loss of the primary particle energy loss.
 //
+// October 19, 2026: Dispatch steps to the registered consumers by particle class.
+//                   The energy loss is the default consumer; optical photons never
+//                   deposit energy and are skipped unless instrumentation needs them.
+//                   Consumers registered for some volumes are looked up by the pre-step volume.
+//
 
 #include "FPSteppingAction.hh"
 #include "FPEventAction.hh"
@@ -9,41 +14,128 @@
 
 #include "G4Step.hh"
 #include "G4RunManager.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4UnitsTable.hh"
 
+namespace {
+
+  // Energy loss of all particles (but optical photons) summed by the event action
+  class FPELossConsumer : public FPStepConsumer
+  {
+  public:
+    FPELossConsumer(FPEventAction* eventAction)
+      : FPStepConsumer(false, true, false), fEventAction(eventAction) {}
+
+    virtual void ProcessStep(const G4Step* step, const G4LogicalVolume*)
+    {
+      // energy deposit
+      auto edep = step->GetTotalEnergyDeposit();
+      if (edep > 0.) {
+	fEventAction->AddELoss(edep);
+	//G4cout << " Energy deposit (in stepping action): " << G4BestUnit(edep, "Energy") << G4endl;
+      }
+    }
+
+  private:
+    FPEventAction* fEventAction;
+  };
+
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 FPSteppingAction::FPSteppingAction(
                       FPEventAction* eventAction)
   : G4UserSteppingAction(),
-    fEventAction(eventAction)
-{}
+    fEventAction(eventAction),
+    fOpticalPhoton(G4OpticalPhoton::Definition())
+{
+  RegisterConsumer(new FPELossConsumer(eventAction));
+  UpdateConsumers();
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 FPSteppingAction::~FPSteppingAction()
-{}
+{
+  for (auto consumer : fConsumers) delete consumer;
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
-void FPSteppingAction::UserSteppingAction(const G4Step* step)
+void FPSteppingAction::RegisterConsumer(FPStepConsumer* consumer)
 {
-    // Collect energy and track length step by step
-    
-    // get volume of the current step
-    auto volume = step->GetPreStepPoint()->GetTouchableHandle()->GetVolume()->GetLogicalVolume();
-    
-    // energy deposit
-    auto edep = step->GetTotalEnergyDeposit();
-          
-    if (edep > 0.) {
-      fEventAction->AddELoss(edep);
-      //G4cout << " Energy deposit (in stepping action): " << G4BestUnit(edep, "Energy") << G4endl;
+  fConsumers.push_back(consumer);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSteppingAction::UpdateConsumers()
+{
+  fOpticalDispatch.Clear();
+  fOtherDispatch.Clear();
+
+  for (auto consumer : fConsumers) {
+    if (!consumer->IsActive()) continue;
+    if (consumer->WantsOpticalPhotons()) fOpticalDispatch.Add(consumer);
+    if (consumer->WantsOtherParticles()) fOtherDispatch.Add(consumer);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSteppingAction::Dispatch::Add(FPStepConsumer* consumer)
+{
+  active = true;
+  needsVolume = needsVolume || consumer->NeedsVolume();
+
+  std::vector<const G4LogicalVolume*> volumes = consumer->GetVolumes();
+  if (volumes.empty()) {
+    consumers.push_back(consumer);
+    return;
+  }
+
+  // Volume-keyed lists: the volume of every step is then needed
+  needsVolume = true;
+  for (auto volume : volumes) {
+    auto entry = byVolume.begin();
+    while (entry != byVolume.end() && entry->first != volume) ++entry;
+    if (entry == byVolume.end()) {
+      byVolume.emplace_back(volume, std::vector<FPStepConsumer*>());
+      entry = byVolume.end() - 1;
     }
-    //if (edep <= 0.) G4cout << " Energy deposit (in stepping action): " << G4BestUnit(edep, "Energy") << G4endl;
-    
-    
+    entry->second.push_back(consumer);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPSteppingAction::UserSteppingAction(const G4Step* step)
+{
+  // Route the step by particle class: for optical photons the lists are
+  // usually empty and this is all the work done
+  G4bool optical = (step->GetTrack()->GetDefinition() == fOpticalPhoton);
+  const Dispatch& dispatch = optical ? fOpticalDispatch : fOtherDispatch;
+  if (!dispatch.active) return;
+
+  // get volume of the current step, only if somebody needs it
+  const G4LogicalVolume* volume = nullptr;
+  if (dispatch.needsVolume) {
+    volume = step->GetPreStepPoint()->GetPhysicalVolume()->GetLogicalVolume();
+  }
+
+  for (auto consumer : dispatch.consumers) consumer->ProcessStep(step, volume);
+
+  // A handful of volumes at most: a linear search is the cheapest lookup
+  for (const auto& entry : dispatch.byVolume) {
+    if (entry.first != volume) continue;
+    for (auto consumer : entry.second) consumer->ProcessStep(step, volume);
+    break;
+  }
+
     /*
     // step length
     G4double stepLength = 0.;
@@ -0,0 +1,237 @@
+/// October 19, 2026: Live run telemetry.
+
+#include "FPTelemetry.hh"
+#include "FPTelemetryMessenger.hh"
+#include "FPStepConsumer.hh"
+
+#include "G4MTRunManager.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+G4ThreadLocal FPTelemetry::LocalCounts FPTelemetry::fgLocal = { 0, 0, 0, 0., 0 };
+G4ThreadLocal G4int FPTelemetry::fgSlot = -1;
+
+namespace {
+
+  // Count the steps of the optical photons of the thread that created it
+  class FPTelemetryConsumer : public FPStepConsumer
+  {
+  public:
+    FPTelemetryConsumer(const FPTelemetry* telemetry, G4long* steps)
+      : FPStepConsumer(true, false, false), fTelemetry(telemetry), fSteps(steps) {}
+
+    virtual G4bool IsActive() const { return fTelemetry->IsEnabled(); }
+
+    virtual void ProcessStep(const G4Step*, const G4LogicalVolume*) { ++*fSteps; }
+
+  private:
+    const FPTelemetry* fTelemetry;
+    G4long* fSteps;
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTelemetry* FPTelemetry::Instance()
+{
+  // Created by the first run action (on the master) and kept for the whole job
+  static FPTelemetry* instance = new FPTelemetry();
+  return instance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTelemetry::FPTelemetry()
+  : fEnabled(false),
+    fFileName("status.json"),
+    fInterval(10.),
+    fNSlots(1),
+    fRunID(0),
+    fNEventsRequested(0),
+    fStartTime(std::chrono::steady_clock::now()),
+    fStopWriter(false),
+    fLastTime(0.),
+    fLastEvents(0),
+    fLastSteps(0),
+    fLastPhotons(0)
+{
+  fMessenger = new FPTelemetryMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTelemetry::~FPTelemetry()
+{
+  if (fWriter.joinable()) EndOfRun();
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPStepConsumer* FPTelemetry::CreateStepConsumer()
+{
+  // Built by the thread whose steps it counts
+  return new FPTelemetryConsumer(this, &fgLocal.opticalSteps);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTelemetry::BeginOfRun(G4int runID, G4int nEventsRequested)
+{
+  if (!fEnabled) return;
+
+  fNSlots = 1;
+  if (G4Threading::IsMultithreadedApplication()) {
+    fNSlots = std::min(G4MTRunManager::GetMasterRunManager()->GetNumberOfThreads(), kMaxSlots);
+  }
+  for (G4int i = 0; i < fNSlots; i++) {
+    fSlots[i].events.store(0, std::memory_order_relaxed);
+    fSlots[i].measured.store(0, std::memory_order_relaxed);
+    fSlots[i].photons.store(0, std::memory_order_relaxed);
+    fSlots[i].photons2.store(0., std::memory_order_relaxed);
+    fSlots[i].opticalSteps.store(0, std::memory_order_relaxed);
+  }
+
+  fRunID = runID;
+  fNEventsRequested = nEventsRequested;
+  fStartTime = std::chrono::steady_clock::now();
+  fLastTime = 0.;
+  fLastEvents = fLastSteps = fLastPhotons = 0;
+
+  fStopWriter = false;
+  fWriter = std::thread(&FPTelemetry::WriterLoop, this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTelemetry::BeginOfThreadRun()
+{
+  fgLocal = { 0, 0, 0, 0., 0 };
+  // Workers count from 0, the master of a sequential run is -1
+  G4int id = std::max(G4Threading::G4GetThreadId(), 0);
+  fgSlot = (id < kMaxSlots) ? id : -1;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTelemetry::EndOfEvent(G4int nPhotons)
+{
+  if (!fEnabled || fgSlot < 0) return;
+
+  fgLocal.events++;
+  if (nPhotons >= 0) {
+    fgLocal.measured++;
+    fgLocal.photons += nPhotons;
+    fgLocal.photons2 += G4double(nPhotons)*nPhotons;
+  }
+
+  // Only this thread writes its slot
+  Slot& slot = fSlots[fgSlot];
+  slot.events.store(fgLocal.events, std::memory_order_relaxed);
+  slot.measured.store(fgLocal.measured, std::memory_order_relaxed);
+  slot.photons.store(fgLocal.photons, std::memory_order_relaxed);
+  slot.photons2.store(fgLocal.photons2, std::memory_order_relaxed);
+  slot.opticalSteps.store(fgLocal.opticalSteps, std::memory_order_relaxed);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTelemetry::EndOfRun()
+{
+  if (!fWriter.joinable()) return;
+
+  {
+    std::lock_guard<G4Mutex> lock(fWriterMutex);
+    fStopWriter = true;
+  }
+  fWakeUp.notify_one();
+  fWriter.join();
+
+  // The workers are done: their last events are in the slots
+  WriteStatus(true);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTelemetry::WriterLoop()
+{
+  std::unique_lock<G4Mutex> lock(fWriterMutex);
+  while (!fStopWriter) {
+    fWakeUp.wait_for(lock, std::chrono::duration<G4double>(fInterval));
+    if (!fStopWriter) WriteStatus(false);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTelemetry::WriteStatus(G4bool done)
+{
+  G4double elapsed = std::chrono::duration<G4double>(std::chrono::steady_clock::now() - fStartTime).count();
+
+  std::vector<G4long> threadEvents;
+  G4long events = 0, measured = 0, photons = 0, steps = 0;
+  G4double photons2 = 0.;
+  for (G4int i = 0; i < fNSlots; i++) {
+    const Slot& slot = fSlots[i];
+    threadEvents.push_back(slot.events.load(std::memory_order_relaxed));
+    events   += threadEvents.back();
+    measured += slot.measured.load(std::memory_order_relaxed);
+    photons  += slot.photons.load(std::memory_order_relaxed);
+    photons2 += slot.photons2.load(std::memory_order_relaxed);
+    steps    += slot.opticalSteps.load(std::memory_order_relaxed);
+  }
+
+  // Mean light yield and its error
+  G4double mean = 0., error = 0.;
+  if (measured > 0) mean = G4double(photons)/measured;
+  if (measured > 1) {
+    G4double variance = std::max((photons2 - measured*mean*mean)/(measured - 1), 0.);
+    error = std::sqrt(variance/measured);
+  }
+
+  // Rates over the last interval, time to go from the rate of the whole run
+  G4double dt = elapsed - fLastTime;
+  G4double eventRate = (dt > 0.) ? (events - fLastEvents)/dt : 0.;
+  G4double stepRate = (dt > 0.) ? (steps - fLastSteps)/dt : 0.;
+  G4double photonRate = (dt > 0.) ? (photons - fLastPhotons)/dt : 0.;
+  G4double eta = -1.;
+  if (done) eta = 0.;
+  else if (events > 0) eta = std::max(fNEventsRequested - events, G4long(0))*elapsed/events;
+  fLastTime = elapsed;
+  fLastEvents = events;
+  fLastSteps = steps;
+  fLastPhotons = photons;
+
+  G4String temporary = fFileName + ".tmp";
+  std::ofstream out(temporary);
+  if (!out) return;
+  out << "{\n  \"run\": " << fRunID
+      << ",\n  \"state\": \"" << (done ? "done" : "running") << "\""
+      << ",\n  \"elapsedSeconds\": " << elapsed
+      << ",\n  \"eventsRequested\": " << fNEventsRequested
+      << ",\n  \"eventsDone\": " << events
+      << ",\n  \"threadEvents\": [";
+  for (std::size_t i = 0; i < threadEvents.size(); i++) out << (i ? ", " : " ") << threadEvents[i];
+  out << " ],\n  \"eventsPerSecond\": " << eventRate
+      << ",\n  \"opticalStepsPerSecond\": " << stepRate
+      << ",\n  \"photonsPerSecond\": " << photonRate
+      << ",\n  \"lightYield\": " << mean
+      << ",\n  \"lightYieldError\": " << error
+      << ",\n  \"etaSeconds\": " << eta
+      << "\n}\n";
+  out.close();
+
+  // Atomic on POSIX file systems: the readers see the old or the new file
+  if (out.fail() || std::rename(temporary.c_str(), fFileName.c_str()) != 0) {
+    G4ExceptionDescription msg;
+    msg << "Cannot write the status file " << fFileName << ".";
+    G4Exception("FPTelemetry::WriteStatus()", "FPTel001", JustWarning, msg);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,79 @@
+/// October 19, 2026: Run telemetry messenger.
+///
+///    /FP/telemetry/enable   : rewrite a status file of the run periodically
+///    /FP/telemetry/fileName : name of the status file
+///    /FP/telemetry/interval : time between two updates
+///
+///    The telemetry is shared by all threads: the commands are not broadcast.
+
+#include "globals.hh"
+
+#include "FPTelemetryMessenger.hh"
+
+#include "FPTelemetry.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4SystemOfUnits.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTelemetryMessenger::FPTelemetryMessenger(FPTelemetry* FPTel)
+:FPStatus(FPTel)
+{
+  telemetryDir = new G4UIdirectory("/FP/telemetry/");
+  telemetryDir->SetGuidance("Live status file of the run:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/telemetry/enable", this);
+  SetEnableCmd->SetGuidance("Rewrite a status file (JSON) during the runs: events per thread, events,");
+  SetEnableCmd->SetGuidance("optical steps and photons per second, light yield, time to go.");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetEnableCmd->SetToBeBroadcasted(false);
+
+  SetFileNameCmd = new G4UIcmdWithAString("/FP/telemetry/fileName", this);
+  SetFileNameCmd->SetGuidance("Name of the status file (default status.json)");
+  SetFileNameCmd->SetParameterName("fileName", false);
+  SetFileNameCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetFileNameCmd->SetToBeBroadcasted(false);
+
+  SetIntervalCmd = new G4UIcmdWithADoubleAndUnit("/FP/telemetry/interval", this);
+  SetIntervalCmd->SetGuidance("Time between two updates of the status file");
+  SetIntervalCmd->SetParameterName("interval", false);
+  SetIntervalCmd->SetRange("interval > 0.");
+  SetIntervalCmd->SetUnitCategory("Time");
+  SetIntervalCmd->SetDefaultUnit("s");
+  SetIntervalCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  SetIntervalCmd->SetToBeBroadcasted(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTelemetryMessenger::~FPTelemetryMessenger()
+{
+  delete SetEnableCmd;
+  delete SetFileNameCmd;
+  delete SetIntervalCmd;
+  delete telemetryDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTelemetryMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPStatus->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetFileNameCmd ) {
+      FPStatus->SetFileName(newValues);
+    }
+
+    if (command == SetIntervalCmd ) {
+      FPStatus->SetInterval(SetIntervalCmd->GetNewDoubleValue(newValues)/s);
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
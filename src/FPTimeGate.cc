@@ -0,0 +1,151 @@
+/// October 19, 2026: Readout time gate.
+
+#include "FPTimeGate.hh"
+#include "FPTimeGateMessenger.hh"
+#include "FPStepConsumer.hh"
+#include "FPTrackInformation.hh"
+#include "FPPhotonFates.hh"
+
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UnitsTable.hh"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+
+G4ThreadLocal FPTimeGate* FPTimeGate::fgInstance = nullptr;
+
+namespace {
+
+  // Kill the optical photons past the end of the gate
+  class FPTimeGateConsumer : public FPStepConsumer
+  {
+  public:
+    FPTimeGateConsumer(FPTimeGate* gate)
+      : FPStepConsumer(true, false, false), fGate(gate) {}
+
+    virtual G4bool IsActive() const { return fGate->IsEnabled(); }
+
+    virtual void ProcessStep(const G4Step* step, const G4LogicalVolume*)
+    {
+      G4Track* track = step->GetTrack();
+      G4double time = track->GetGlobalTime();
+      if (time < fGate->GetEnd() || track->GetTrackStatus() != fAlive) return;
+
+      track->SetTrackStatus(fStopAndKill);
+      auto info = static_cast<FPTrackInformation*>(track->GetUserInformation());
+      if (info) info->SetFate(FPPhotonFates::kKilled);
+
+      // Distance travelled since the end of the gate, on this step
+      G4double late = std::min(time - fGate->GetEnd(), step->GetDeltaTime());
+      fGate->AddKilledPhoton(late*track->GetVelocity());
+    }
+
+  private:
+    FPTimeGate* fGate;
+  };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTimeGate::FPTimeGate()
+  : G4VAccumulable("TimeGate"),
+    fEnabled(false),
+    fStart(0.),
+    fWidth(250.*ns),
+    fEnd(250.*ns)
+{
+  Reset();
+  fgInstance = this;
+  fMessenger = new FPTimeGateMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTimeGate::~FPTimeGate()
+{
+  if (fgInstance == this) fgInstance = nullptr;
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPStepConsumer* FPTimeGate::CreateStepConsumer()
+{
+  return new FPTimeGateConsumer(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTimeGate::Merge(const G4VAccumulable& other)
+{
+  const FPTimeGate& gate = static_cast<const FPTimeGate&>(other);
+  fNKilled    += gate.fNKilled;
+  fLateLength += gate.fLateLength;
+  fNDropped   += gate.fNDropped;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTimeGate::Reset()
+{
+  fNKilled = 0;
+  fLateLength = 0.;
+  fNDropped = 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTimeGate::Print() const
+{
+  if (!fEnabled) return;
+
+  G4cout << G4endl << " Readout gate [" << G4BestUnit(fStart, "Time") << ", "
+	 << G4BestUnit(fEnd, "Time") << "):" << G4endl
+	 << "   late photons killed : " << fNKilled << " (last step "
+	 << G4BestUnit(fLateLength, "Length") << " past the gate)" << G4endl
+	 << "   hits dropped        : " << fNDropped << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTimeGate::Save(std::ostream& out) const
+{
+  out.write(reinterpret_cast<const char*>(&fStart), sizeof(fStart));
+  out.write(reinterpret_cast<const char*>(&fWidth), sizeof(fWidth));
+  out.write(reinterpret_cast<const char*>(&fNKilled), sizeof(fNKilled));
+  out.write(reinterpret_cast<const char*>(&fLateLength), sizeof(fLateLength));
+  out.write(reinterpret_cast<const char*>(&fNDropped), sizeof(fNDropped));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTimeGate::Restore(std::istream& in, G4bool takeSettings)
+{
+  G4long nKilled, nDropped;
+  G4double start, width, lateLength;
+  if (!in.read(reinterpret_cast<char*>(&start), sizeof(start))
+      || !in.read(reinterpret_cast<char*>(&width), sizeof(width))
+      || !in.read(reinterpret_cast<char*>(&nKilled), sizeof(nKilled))
+      || !in.read(reinterpret_cast<char*>(&lateLength), sizeof(lateLength))
+      || !in.read(reinterpret_cast<char*>(&nDropped), sizeof(nDropped))) return;
+  if (takeSettings) {
+    SetStart(start);
+    SetWidth(width);
+  } else if (start != fStart || width != fWidth) {
+    // Workers and master use the gate of the macro: the counts are added as they are
+    G4ExceptionDescription msg;
+    msg << "Checkpoint counts of a gate [" << G4BestUnit(start, "Time") << ", "
+	<< G4BestUnit(start + width, "Time") << "), the gate is now ["
+	<< G4BestUnit(fStart, "Time") << ", " << G4BestUnit(fEnd, "Time") << ")";
+    G4Exception("FPTimeGate::Restore()", "FPGate001", JustWarning, msg);
+  }
+  fNKilled    += nKilled;
+  fLateLength += lateLength;
+  fNDropped   += nDropped;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,74 @@
+/// October 19, 2026: Readout time gate messenger.
+///
+///    /FP/gate/enable : drop the hits outside the gate and kill the optical photons past its end
+///    /FP/gate/start  : beginning of the gate (global time)
+///    /FP/gate/width  : length of the gate
+
+#include "globals.hh"
+
+#include "FPTimeGateMessenger.hh"
+
+#include "FPTimeGate.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTimeGateMessenger::FPTimeGateMessenger(FPTimeGate* FPGat)
+:FPGate(FPGat)
+{
+  gateDir = new G4UIdirectory("/FP/gate/");
+  gateDir->SetGuidance("Readout time gate:");
+
+  SetEnableCmd = new G4UIcmdWithABool("/FP/gate/enable", this);
+  SetEnableCmd->SetGuidance("Drop the SiPM hits outside the gate and kill the optical photons");
+  SetEnableCmd->SetGuidance("whose global time passes its end");
+  SetEnableCmd->SetParameterName("enable", true);
+  SetEnableCmd->SetDefaultValue(true);
+  SetEnableCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetStartCmd = new G4UIcmdWithADoubleAndUnit("/FP/gate/start", this);
+  SetStartCmd->SetGuidance("Beginning of the gate (global time)");
+  SetStartCmd->SetParameterName("start", false);
+  SetStartCmd->SetUnitCategory("Time");
+  SetStartCmd->SetDefaultUnit("ns");
+  SetStartCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetWidthCmd = new G4UIcmdWithADoubleAndUnit("/FP/gate/width", this);
+  SetWidthCmd->SetGuidance("Length of the gate");
+  SetWidthCmd->SetParameterName("width", false);
+  SetWidthCmd->SetRange("width > 0.");
+  SetWidthCmd->SetUnitCategory("Time");
+  SetWidthCmd->SetDefaultUnit("ns");
+  SetWidthCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTimeGateMessenger::~FPTimeGateMessenger()
+{
+  delete SetEnableCmd;
+  delete SetStartCmd;
+  delete SetWidthCmd;
+  delete gateDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTimeGateMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetEnableCmd ) {
+      FPGate->SetEnabled(SetEnableCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetStartCmd ) {
+      FPGate->SetStart(SetStartCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetWidthCmd ) {
+      FPGate->SetWidth(SetWidthCmd->GetNewDoubleValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,43 @@
+/// October 19, 2026: User track information for optical photons.
+
+#include "FPTrackInformation.hh"
+#include "G4SystemOfUnits.hh"
+
+G4ThreadLocal G4Allocator<FPTrackInformation>* FPTrackInformationAllocator = nullptr;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrackInformation::FPTrackInformation(const G4ThreeVector& origin)
+  : G4VUserTrackInformation(),
+    fOrigin(origin),
+    fFate(-1),
+    fBounces(0),
+    fPathLength(0.),
+    fRouletteLevel(0)
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrackInformation::FPTrackInformation(const FPTrackInformation* parent)
+  : G4VUserTrackInformation(),
+    fOrigin(parent->fOrigin),
+    fFate(-1),
+    fBounces(0),
+    fPathLength(0.),
+    fRouletteLevel(0)
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrackInformation::~FPTrackInformation()
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTrackInformation::Print() const
+{
+  G4cout << "     Print:: photon origin = " << fOrigin/mm << " mm, fate = " << fFate
+	 << ", bounces = " << fBounces << ", path = " << fPathLength/mm << " mm" << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,100 @@
+/// October 19, 2026: Tracking action.
+///                   Downsampled trajectories, and thinning of the optical photon ones.
+///                   Track information also for the bounce and path length limiter.
+
+#include "FPTrackingAction.hh"
+#include "FPTrackInformation.hh"
+#include "FPSpatialMaps.hh"
+#include "FPPhotonFates.hh"
+#include "FPTrajectory.hh"
+#include "FPTrajectoryFilter.hh"
+#include "FPPhotonLimiter.hh"
+
+#include "G4Track.hh"
+#include "G4TrackVector.hh"
+#include "G4TrackingManager.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4ProcessTable.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrackingAction::FPTrackingAction()
+  : G4UserTrackingAction(),
+    fOpticalPhoton(G4OpticalPhoton::Definition()),
+    fScintillation(nullptr)
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrackingAction::~FPTrackingAction()
+{ }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTrackingAction::PreUserTrackingAction(const G4Track* track)
+{
+  // Our own trajectory, when trajectories are stored and thinned
+  FPTrajectoryFilter* filter = FPTrajectoryFilter::Instance();
+  G4bool thinning = filter && filter->IsEnabled() && fpTrackingManager->GetStoreTrajectory();
+  if (thinning) {
+    fpTrackingManager->SetTrajectory(new FPTrajectory(track, filter->GetMinPointDistance()));
+  }
+
+  if (track->GetDefinition() != fOpticalPhoton) return;
+
+  FPSpatialMaps* maps = FPSpatialMaps::Instance();
+  FPPhotonFates* fates = FPPhotonFates::Instance();
+  G4bool mapsEnabled = maps && maps->IsEnabled();
+  FPPhotonLimiter* limiter = FPPhotonLimiter::Instance();
+  if (!mapsEnabled && !(fates && fates->IsEnabled()) && !thinning
+      && !(limiter && limiter->IsEnabled())) return;
+
+  // Photons not produced by another optical photon start a new history
+  if (!track->GetUserInformation()) {
+    track->SetUserInformation(new FPTrackInformation(track->GetVertexPosition()));
+  }
+
+  if (!mapsEnabled) return;
+
+  if (!fScintillation) {
+    fScintillation = G4ProcessTable::GetProcessTable()->FindProcess("Scintillation", "e-");
+  }
+  if (fScintillation && track->GetCreatorProcess() == fScintillation) {
+    maps->AddScintillationPhoton(track->GetVertexPosition());
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTrackingAction::PostUserTrackingAction(const G4Track* track)
+{
+  auto info = static_cast<const FPTrackInformation*>(track->GetUserInformation());
+  if (!info) return;
+
+  FPPhotonFates* fates = FPPhotonFates::Instance();
+  if (fates && fates->IsEnabled()) fates->Classify(track);
+
+  // Drop the trajectory of the photons neither detected nor sampled. Not with
+  // /tracking/verbose: the tracking manager then shows the trajectory after
+  // this action and expects one
+  FPTrajectoryFilter* filter = FPTrajectoryFilter::Instance();
+  G4VTrajectory* trajectory = fpTrackingManager->GimmeTrajectory();
+  if (trajectory && filter && filter->IsEnabled() && track->GetTrackStatus() != fSuspend
+      && fpTrackingManager->GetVerboseLevel() == 0
+      && !filter->KeepPhoton(track->GetTrackID(), track->GetParentID(),
+			     info->GetFate() == FPPhotonFates::kDetected)) {
+    delete trajectory;
+    fpTrackingManager->SetTrajectory(nullptr);
+  }
+
+  // WLS photons inherit the origin of the photon they were produced by
+  G4TrackVector* secondaries = fpTrackingManager->GimmeSecondaries();
+  if (!secondaries) return;
+  for (auto secondary : *secondaries) {
+    if (secondary->GetDefinition() == fOpticalPhoton && !secondary->GetUserInformation()) {
+      secondary->SetUserInformation(new FPTrackInformation(info));
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,81 @@
+/// October 19, 2026: Downsampled trajectory.
+
+#include "FPTrajectory.hh"
+
+#include "G4Track.hh"
+#include "G4Step.hh"
+#include "G4ParticleDefinition.hh"
+
+G4ThreadLocal G4Allocator<FPTrajectory>* FPTrajectoryAllocator = nullptr;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrajectory::FPTrajectory(const G4Track* track, G4double minPointDistance)
+  : G4VTrajectory(),
+    fLastPoint(track->GetPosition()),
+    fMinDistance2(minPointDistance*minPointDistance),
+    fTrackID(track->GetTrackID()),
+    fParentID(track->GetParentID()),
+    fParticle(track->GetDefinition()),
+    fInitialMomentum(track->GetMomentum())
+{
+  fPoints.push_back(new G4TrajectoryPoint(track->GetPosition()));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrajectory::~FPTrajectory()
+{
+  for (auto point : fPoints) delete point;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4String FPTrajectory::GetParticleName() const
+{
+  return fParticle->GetParticleName();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double FPTrajectory::GetCharge() const
+{
+  return fParticle->GetPDGCharge();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int FPTrajectory::GetPDGEncoding() const
+{
+  return fParticle->GetPDGEncoding();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTrajectory::AppendStep(const G4Step* step)
+{
+  const G4ThreeVector& position = step->GetPostStepPoint()->GetPosition();
+  G4bool last = step->GetTrack()->GetTrackStatus() != fAlive;
+  if (!last && (position - fLastPoint).mag2() < fMinDistance2) return;
+
+  fPoints.push_back(new G4TrajectoryPoint(position));
+  fLastPoint = position;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTrajectory::MergeTrajectory(G4VTrajectory* secondTrajectory)
+{
+  if (!secondTrajectory) return;
+
+  // The first point of the other trajectory is the last one of this one
+  FPTrajectory* second = static_cast<FPTrajectory*>(secondTrajectory);
+  for (std::size_t i = 1; i < second->fPoints.size(); i++) fPoints.push_back(second->fPoints[i]);
+  if (!second->fPoints.empty()) {
+    delete second->fPoints[0];
+    second->fPoints.clear();
+  }
+  fLastPoint = fPoints.back()->GetPosition();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
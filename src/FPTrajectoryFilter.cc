@@ -0,0 +1,48 @@
+/// October 19, 2026: Trajectory thinning for visualization sessions.
+
+#include "FPTrajectoryFilter.hh"
+#include "FPTrajectoryFilterMessenger.hh"
+
+#include "G4SystemOfUnits.hh"
+
+#include <cstdint>
+
+G4ThreadLocal FPTrajectoryFilter* FPTrajectoryFilter::fgInstance = nullptr;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrajectoryFilter::FPTrajectoryFilter()
+  : fEnabled(false),
+    fPhotonFraction(0.01),
+    fMaxPhotons(100),
+    fMinPointDistance(1.*mm),
+    fSampled(0)
+{
+  fgInstance = this;
+  fMessenger = new FPTrajectoryFilterMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrajectoryFilter::~FPTrajectoryFilter()
+{
+  if (fgInstance == this) fgInstance = nullptr;
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool FPTrajectoryFilter::KeepPhoton(G4int trackID, G4int parentID, G4bool detected)
+{
+  if (detected || parentID == 0) return true;
+  if (fSampled >= fMaxPhotons) return false;
+
+  // Multiplicative hash of the track ID, uniform in [0, 1)
+  uint32_t hash = (uint32_t) trackID*2654435761u;
+  if (hash*(1./4294967296.) >= fPhotonFraction) return false;
+
+  fSampled++;
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
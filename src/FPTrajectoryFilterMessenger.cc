@@ -0,0 +1,86 @@
+/// October 19, 2026: Trajectory thinning messenger.
+///
+///    /FP/vis/thinning         : keep only sampled optical photon trajectories (and those detected)
+///    /FP/vis/photonFraction   : fraction of the optical photon trajectories kept
+///    /FP/vis/maxPhotons       : maximum number of sampled optical photon trajectories per event
+///    /FP/vis/minPointDistance : minimum distance between two stored trajectory points (0: all)
+
+#include "globals.hh"
+
+#include "FPTrajectoryFilterMessenger.hh"
+
+#include "FPTrajectoryFilter.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrajectoryFilterMessenger::FPTrajectoryFilterMessenger(FPTrajectoryFilter* FPFilt)
+:FPFilter(FPFilt)
+{
+  visDir = new G4UIdirectory("/FP/vis/");
+  visDir->SetGuidance("Trajectory thinning for visualization:");
+
+  SetThinningCmd = new G4UIcmdWithABool("/FP/vis/thinning", this);
+  SetThinningCmd->SetGuidance("Keep only sampled optical photon trajectories (and those detected)");
+  SetThinningCmd->SetParameterName("enable", true);
+  SetThinningCmd->SetDefaultValue(true);
+  SetThinningCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetPhotonFractionCmd = new G4UIcmdWithADouble("/FP/vis/photonFraction", this);
+  SetPhotonFractionCmd->SetGuidance("Fraction of the optical photon trajectories kept");
+  SetPhotonFractionCmd->SetParameterName("fraction", false);
+  SetPhotonFractionCmd->SetRange("fraction >= 0. && fraction <= 1.");
+  SetPhotonFractionCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetMaxPhotonsCmd = new G4UIcmdWithAnInteger("/FP/vis/maxPhotons", this);
+  SetMaxPhotonsCmd->SetGuidance("Maximum number of sampled optical photon trajectories per event");
+  SetMaxPhotonsCmd->SetParameterName("n", false);
+  SetMaxPhotonsCmd->SetRange("n >= 0");
+  SetMaxPhotonsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  SetMinPointDistanceCmd = new G4UIcmdWithADoubleAndUnit("/FP/vis/minPointDistance", this);
+  SetMinPointDistanceCmd->SetGuidance("Minimum distance between two stored trajectory points (0: all)");
+  SetMinPointDistanceCmd->SetParameterName("distance", false);
+  SetMinPointDistanceCmd->SetRange("distance >= 0.");
+  SetMinPointDistanceCmd->SetUnitCategory("Length");
+  SetMinPointDistanceCmd->SetDefaultUnit("mm");
+  SetMinPointDistanceCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+FPTrajectoryFilterMessenger::~FPTrajectoryFilterMessenger()
+{
+  delete SetThinningCmd;
+  delete SetPhotonFractionCmd;
+  delete SetMaxPhotonsCmd;
+  delete SetMinPointDistanceCmd;
+  delete visDir;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPTrajectoryFilterMessenger::SetNewValue(G4UIcommand* command, G4String newValues)
+{
+    if (command == SetThinningCmd ) {
+      FPFilter->SetEnabled(SetThinningCmd->GetNewBoolValue(newValues));
+    }
+
+    if (command == SetPhotonFractionCmd ) {
+      FPFilter->SetPhotonFraction(SetPhotonFractionCmd->GetNewDoubleValue(newValues));
+    }
+
+    if (command == SetMaxPhotonsCmd ) {
+      FPFilter->SetMaxPhotons(SetMaxPhotonsCmd->GetNewIntValue(newValues));
+    }
+
+    if (command == SetMinPointDistanceCmd ) {
+      FPFilter->SetMinPointDistance(SetMinPointDistanceCmd->GetNewDoubleValue(newValues));
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
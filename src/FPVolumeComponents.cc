@@ -0,0 +1,42 @@
+/// October 19, 2026: Detector components of the logical volumes.
+
+#include "FPVolumeComponents.hh"
+
+#include "G4LogicalVolumeStore.hh"
+
+#include <algorithm>
+
+namespace {
+
+  const char* componentNames[FPVolumeComponents::kNComponents] =
+    { "panel", "epoxy", "cladding", "fiber", "wrapping", "SiPM", "other" };
+  const char* componentVolumes[FPVolumeComponents::kOther] =
+    { "PanelLV", "EpoxyLV", "CladdingLV", "FiberLV", "WrappingLV", "sipmLV" };
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void FPVolumeComponents::Build()
+{
+  G4LogicalVolumeStore* store = G4LogicalVolumeStore::GetInstance();
+  G4int maxID = -1;
+  for (auto volume : *store) maxID = std::max(maxID, volume->GetInstanceID());
+  fComponentOfVolume.assign(maxID + 1, kOther);
+  for (auto volume : *store) {
+    for (G4int component = 0; component < kOther; component++) {
+      if (volume->GetName() == componentVolumes[component]) {
+	fComponentOfVolume[volume->GetInstanceID()] = component;
+      }
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+const char* FPVolumeComponents::GetName(G4int component)
+{
+  return componentNames[component];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -6,6 +6,8 @@
 ///                 Added G4 system unit header
 ///                 
 ///
+/// October 19, 2026: Thread local allocator (hits are created by the worker threads).
+///
 /// Implement SiPM hit class:
 ///    This class stores information of a photon hit from the wls fiber
 
@@ -13,12 +15,16 @@
 #include "G4SystemOfUnits.hh"
 
 // -- one more nasty trick for new and delete operator overloading:
-G4Allocator<SiPMHit> SiPMHitAllocator;
+G4ThreadLocal G4Allocator<SiPMHit>* SiPMHitAllocator = nullptr;
 
 SiPMHit::SiPMHit()
 {
   //  eDep = 0.0;
   photonCounts = 0;
+  time = 0.0;
+  energy = 0.0;
+  channel = 0;
+  weight = 1.0;
 }
 
 SiPMHit::~SiPMHit()
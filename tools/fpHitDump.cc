@@ -0,0 +1,48 @@
+/// October 19, 2026: Print the detected photons of events of a raw hit stream.
+///
+///    The events are found through the index of the stream file, without
+///    reading the whole file.
+///
+///    Usage: fpHitDump file.hits eventID [eventID ...]
+
+#include "FPHitStream.hh"
+
+#include "G4SystemOfUnits.hh"
+#include "globals.hh"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  if (argc < 3) {
+    std::cerr << " Usage: fpHitDump file.hits eventID [eventID ...]" << std::endl;
+    return 1;
+  }
+
+  G4int status = 0;
+  std::vector<FPStreamHit> hits;
+  for (int i = 2; i < argc; i++) {
+    G4int eventID = std::atoi(argv[i]);
+    if (!FPHitStream::ReadEvent(argv[1], eventID, hits)) {
+      std::cerr << "fpHitDump: event " << eventID << " not found in " << argv[1] << std::endl;
+      status = 2;
+      continue;
+    }
+    std::cout << "Event " << eventID << ": " << hits.size() << " photons" << std::endl;
+    for (const auto& hit : hits) {
+      std::cout << std::setw(6) << hit.channel
+		<< std::setw(12) << std::fixed << std::setprecision(3) << hit.time/ns << " ns"
+		<< std::setw(12) << hit.position.x()/mm << std::setw(12) << hit.position.y()/mm
+		<< std::setw(12) << hit.position.z()/mm << " mm"
+		<< std::setw(10) << std::setprecision(2) << hit.wavelength/nm << " nm" << std::endl;
+    }
+  }
+  return status;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
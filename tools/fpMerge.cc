@@ -0,0 +1,275 @@
+/// October 19, 2026: Merge the results of the jobs written by fpSplit.
+///
+///    Every job keeps, in its checkpoint directory, the summary of each of
+///    its events and the states of its spatial maps and photon fates. The
+///    merge reads them for all the jobs of the manifest and writes
+///      <out>.root      the run histograms, refilled from the event records
+///                      (the same contents as the sum of the job histograms),
+///                      and an "events" ntuple (job, eventID, nPhotons, eLoss)
+///      <out>Maps.bin   the summed spatial maps, if the jobs made them
+///    then prints the light yield and eLoss statistics, the photon fates,
+///    the SiPM signal features, the coincidence trigger, time gate and photon
+///    limiter counts.
+///
+///    Checks, any failure giving a non-zero exit status unless -f is given:
+///      - a job directory or checkpoint is missing,
+///      - a job has checkpoints of runs other than the run of the manifest
+///        ("run" line written by fpSplit, 0 if none; -r overrides it), e.g.
+///        when its macro did a warm-up /run/beamOn the split did not declare,
+///      - a job has fewer or more events than requested (interrupted job,
+///        or a checkpoint of another run),
+///      - an event appears twice in a job,
+///      - two jobs have the same seeds or random engine state (duplicates).
+///
+///    Usage: fpMerge -i manifest [-o output] [-r runID] [-f]
+
+#include "FPCheckpoint.hh"
+#include "FPRunAction.hh"
+#include "FPSpatialMaps.hh"
+#include "FPPhotonFates.hh"
+#include "FPSiPMDigitizer.hh"
+#include "FPCoincidenceTrigger.hh"
+#include "FPTimeGate.hh"
+#include "FPPhotonLimiter.hh"
+#include "FPWelford.hh"
+
+#include "G4RootAnalysisManager.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UnitsTable.hh"
+#include "globals.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  struct Job
+  {
+    int         index;
+    long        events;
+    long        seeds[2];
+    std::string directory;
+  };
+
+  void PrintUsage()
+  {
+    std::cerr << " Usage: fpMerge -i manifest [-o output] [-r runID] [-f]" << std::endl;
+  }
+
+  G4bool ReadManifest(const std::string& fileName, long& nEvents, G4int& runID,
+		      std::vector<Job>& jobs)
+  {
+    std::ifstream in(fileName);
+    if (!in) return false;
+    std::string line;
+    long nJobs = -1;
+    while (std::getline(in, line)) {
+      std::istringstream fields(line);
+      std::string key;
+      if (!(fields >> key) || key[0] == '#') continue;
+      if      (key == "events") fields >> nEvents;
+      else if (key == "run")    fields >> runID;
+      else if (key == "jobs")   fields >> nJobs;
+      else if (key == "job") {
+	Job job;
+	if (!(fields >> job.index >> job.events >> job.seeds[0] >> job.seeds[1] >> job.directory)) {
+	  return false;
+	}
+	jobs.push_back(job);
+      }
+    }
+    return nJobs == (long) jobs.size();
+  }
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  std::string manifestName;
+  std::string output = "merged";
+  G4bool force = false;
+  G4int runOption = -1;
+  for (int i = 1; i < argc; i++) {
+    std::string option = argv[i];
+    if      (option == "-i" && i + 1 < argc) manifestName = argv[++i];
+    else if (option == "-o" && i + 1 < argc) output = argv[++i];
+    else if (option == "-r" && i + 1 < argc) runOption = std::atoi(argv[++i]);
+    else if (option == "-f") force = true;
+    else {
+      PrintUsage();
+      return 1;
+    }
+  }
+  if (manifestName.empty()) {
+    PrintUsage();
+    return 1;
+  }
+
+  long nEvents = 0;
+  G4int runID = 0;
+  std::vector<Job> jobs;
+  if (!ReadManifest(manifestName, nEvents, runID, jobs)) {
+    std::cerr << "fpMerge: bad or missing manifest " << manifestName << std::endl;
+    return 1;
+  }
+  if (runOption >= 0) runID = runOption;
+
+  G4RootAnalysisManager* analysisManager = G4RootAnalysisManager::Instance();
+  analysisManager->SetVerboseLevel(0);
+  analysisManager->OpenFile(output + ".root");
+  FPRunAction::BookHistograms();
+  analysisManager->CreateNtuple("events", "Events of all the jobs");
+  analysisManager->CreateNtupleIColumn("job");
+  analysisManager->CreateNtupleIColumn("eventID");
+  analysisManager->CreateNtupleIColumn("nPhotons");
+  analysisManager->CreateNtupleDColumn("eLoss");
+  analysisManager->FinishNtuple();
+
+  FPSpatialMaps maps;
+  maps.SetFileName(output + "Maps.bin");
+  FPPhotonFates fates;
+  FPSiPMDigitizer digitizer;
+  FPCoincidenceTrigger trigger;
+  FPTimeGate gate;
+  FPPhotonLimiter limiter;
+  FPWelford lightYield, eLoss;
+
+  int nErrors = 0;
+  long nMerged = 0;
+  std::vector<std::string> engines;
+  for (std::size_t j = 0; j < jobs.size(); j++) {
+    const Job& job = jobs[j];
+
+    for (std::size_t k = 0; k < j; k++) {
+      if (jobs[k].seeds[0] == job.seeds[0] && jobs[k].seeds[1] == job.seeds[1]) {
+	std::cerr << "fpMerge: jobs " << jobs[k].index << " and " << job.index
+		  << " have the same seeds" << std::endl;
+	nErrors++;
+      }
+    }
+
+    // The job run must be the only checkpointed run of the job
+    std::vector<G4int> runs = FPCheckpoint::ListRuns(job.directory + "/checkpoint");
+    if (!runs.empty() && (runs.size() > 1 || runs[0] != runID)) {
+      std::cerr << "fpMerge: job " << job.index << " has checkpoints of run(s)";
+      for (G4int run : runs) std::cerr << " " << run;
+      std::cerr << ", expected run " << runID << " only (see -r)" << std::endl;
+      nErrors++;
+      if (std::find(runs.begin(), runs.end(), runID) == runs.end()) continue;
+    }
+
+    G4int generation = 0;
+    std::string engine;
+    std::vector<FPCheckpointShard> shards;
+    if (!FPCheckpoint::Load(job.directory + "/checkpoint", runID, generation, engine, shards)) {
+      std::cerr << "fpMerge: no results for job " << job.index << " in " << job.directory
+		<< std::endl;
+      nErrors++;
+      continue;
+    }
+    for (std::size_t k = 0; k < engines.size(); k++) {
+      if (engines[k] == engine) {
+	std::cerr << "fpMerge: job " << job.index << " duplicates an earlier job"
+		  << " (same random engine state)" << std::endl;
+	nErrors++;
+      }
+    }
+    engines.push_back(engine);
+
+    std::vector<G4int> eventIDs;
+    for (const auto& shard : shards) {
+      for (const auto& record : shard.records) {
+	eventIDs.push_back(record.eventID);
+	FPRunAction::FillHistograms(record);
+	analysisManager->FillNtupleIColumn(0, job.index);
+	analysisManager->FillNtupleIColumn(1, record.eventID);
+	analysisManager->FillNtupleIColumn(2, record.nPhotons);
+	analysisManager->FillNtupleDColumn(3, record.eLoss);
+	analysisManager->AddNtupleRow();
+	if (record.nPhotons != FPEventRecord::kPhotonsNotCounted) lightYield.Fill(record.nPhotons);
+	eLoss.Fill(record.eLoss);
+      }
+
+      auto mapsState = shard.states.find("SpatialMaps");
+      if (mapsState != shard.states.end()) {
+	maps.SetEnabled(true);
+	std::istringstream in(mapsState->second);
+	maps.Restore(in);
+      }
+      auto fatesState = shard.states.find("PhotonFates");
+      if (fatesState != shard.states.end()) {
+	fates.SetEnabled(true);
+	std::istringstream in(fatesState->second);
+	fates.Restore(in);
+      }
+      auto digitizerState = shard.states.find("SiPMDigitizer");
+      if (digitizerState != shard.states.end()) {
+	digitizer.SetEnabled(true);
+	std::istringstream in(digitizerState->second);
+	digitizer.Restore(in);
+      }
+      auto triggerState = shard.states.find("CoincidenceTrigger");
+      if (triggerState != shard.states.end()) {
+	trigger.SetEnabled(true);
+	std::istringstream in(triggerState->second);
+	trigger.Restore(in);
+      }
+      auto gateState = shard.states.find("TimeGate");
+      if (gateState != shard.states.end()) {
+	gate.SetEnabled(true);
+	std::istringstream in(gateState->second);
+	gate.Restore(in, true);
+      }
+      auto limiterState = shard.states.find("PhotonLimiter");
+      if (limiterState != shard.states.end()) {
+	limiter.SetEnabled(true);
+	std::istringstream in(limiterState->second);
+	limiter.Restore(in, true);
+      }
+    }
+    nMerged += eventIDs.size();
+
+    std::sort(eventIDs.begin(), eventIDs.end());
+    if (std::adjacent_find(eventIDs.begin(), eventIDs.end()) != eventIDs.end()) {
+      std::cerr << "fpMerge: job " << job.index << " has duplicate events" << std::endl;
+      nErrors++;
+    }
+    if ((long) eventIDs.size() != job.events) {
+      std::cerr << "fpMerge: job " << job.index << " has " << eventIDs.size() << " events, "
+		<< job.events << " requested" << std::endl;
+      nErrors++;
+    }
+  }
+
+  analysisManager->Write();
+  analysisManager->CloseFile();
+  maps.Write();
+  fates.Print();
+  digitizer.Print();
+  trigger.Print();
+  gate.Print();
+  limiter.Print();
+
+  G4cout << G4endl << " Merged " << nMerged << " events of " << jobs.size() << " jobs ("
+	 << nEvents << " requested) into " << output << ".root" << G4endl
+	 << "   light yield : " << lightYield.GetMean() << " +- " << lightYield.GetError()
+	 << " photons/event" << G4endl
+	 << "   eLoss       : " << G4BestUnit(eLoss.GetMean(), "Energy") << " +- "
+	 << G4BestUnit(eLoss.GetError(), "Energy") << G4endl;
+
+  if (nErrors > 0) {
+    std::cerr << "fpMerge: " << nErrors << " problem(s) found"
+	      << (force ? ", merged anyway" : "") << std::endl;
+    return force ? 0 : 2;
+  }
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,97 @@
+/// October 19, 2026: Convert a text list of primaries into a replay file.
+///
+///    Each line of the input gives one primary:
+///      eventID pdg energy[MeV] x y z[mm] dx dy dz t[ns]
+///    with the event IDs in increasing order (IDs without primaries give
+///    empty events); '#' starts a comment. The replay file written
+///    (FPPrimaryReplayFile) is then mapped back and compared primary by
+///    primary with the input, so a file that passes is ready for
+///    /FP/gun/replayFile.
+///
+///    Usage: fpReplayConvert input.txt output.replay
+
+#include "FPPrimaryReplayFile.hh"
+
+#include "globals.hh"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  if (argc != 3) {
+    std::cerr << " Usage: fpReplayConvert input.txt output.replay" << std::endl;
+    return 1;
+  }
+
+  std::ifstream infile(argv[1]);
+  if (!infile) {
+    std::cerr << "fpReplayConvert: can not open " << argv[1] << std::endl;
+    return 1;
+  }
+
+  std::vector<std::uint64_t> eventIndex = { 0 };
+  std::vector<FPReplayPrimary> primaries;
+  std::string line;
+  G4int lineNumber = 0;
+  while (std::getline(infile, line)) {
+    lineNumber++;
+    std::size_t comment = line.find('#');
+    if (comment != std::string::npos) line.erase(comment);
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+    FPReplayPrimary primary;
+    std::memset(&primary, 0, sizeof(primary));
+    std::uint64_t eventID;
+    std::istringstream ss(line);
+    ss >> eventID >> primary.pdg >> primary.energy >> primary.x >> primary.y >> primary.z
+       >> primary.dx >> primary.dy >> primary.dz >> primary.t;
+    if (!ss) {
+      std::cerr << "fpReplayConvert: " << argv[1] << ":" << lineNumber
+		<< ": expected 10 values" << std::endl;
+      return 2;
+    }
+    if (eventID + 2 < eventIndex.size()) {
+      std::cerr << "fpReplayConvert: " << argv[1] << ":" << lineNumber
+		<< ": event " << eventID << " out of order" << std::endl;
+      return 2;
+    }
+
+    // Close the events up to this one, empty ones included
+    while (eventIndex.size() < eventID + 2) eventIndex.push_back(primaries.size());
+    primaries.push_back(primary);
+    eventIndex.back() = primaries.size();
+  }
+
+  if (!FPPrimaryReplayFile::Write(argv[2], eventIndex, primaries)) return 3;
+
+  // Round trip: read the file back through the mapping used by the simulation
+  const FPPrimaryReplayFile* replayFile = FPPrimaryReplayFile::Get(argv[2]);
+  if (!replayFile || replayFile->GetNumberOfEvents() != eventIndex.size() - 1
+      || replayFile->GetNumberOfPrimaries() != primaries.size()) {
+    std::cerr << "fpReplayConvert: " << argv[2] << " does not read back" << std::endl;
+    return 4;
+  }
+  for (std::uint64_t event = 0; event + 1 < eventIndex.size(); event++) {
+    std::size_t nPrimaries;
+    const FPReplayPrimary* read = replayFile->GetEvent(event, nPrimaries);
+    if (nPrimaries != eventIndex[event+1] - eventIndex[event]
+	|| (nPrimaries > 0 && std::memcmp(read, &primaries[eventIndex[event]],
+					  nPrimaries*sizeof(FPReplayPrimary)) != 0)) {
+      std::cerr << "fpReplayConvert: event " << event << " differs after reading back" << std::endl;
+      return 4;
+    }
+  }
+
+  std::cout << "fpReplayConvert: " << eventIndex.size() - 1 << " events, "
+	    << primaries.size() << " primaries written to " << argv[2] << std::endl;
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
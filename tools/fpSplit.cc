@@ -0,0 +1,139 @@
+/// October 19, 2026: Split a run into independent jobs.
+///
+///    The requested number of events is divided into N jobs. Each job gets
+///    its own row of the Ranecu seed table (the engine used by fiberPanel),
+///    so the random streams of the jobs do not overlap, and a directory with
+///      job.mac         the base macro, then the seeds and the job outputs
+///      fiberPanel.root histograms of the job
+///      checkpoint/     event records and accumulable states, read by fpMerge
+///    The manifest (manifest.txt) lists the jobs; runLocal.sh runs them all
+///    as background processes of one machine. On a cluster submit one
+///    "fiberPanel -m <dir>/job.mac" per job instead. A job that was
+///    interrupted resumes from its checkpoint when it is started again.
+///
+///    The base macro sets up the run (/run/initialize, /FP/... commands). If
+///    it also runs events (a warm-up /run/beamOn), give with -r the number
+///    of such runs: it is the run ID of the job run, written to the manifest
+///    so that fpMerge reads the checkpoint of that run.
+///
+///    Usage: fpSplit -n events -j jobs -m baseMacro [-o outDir] [-s firstSeedRow]
+///                   [-t threadsPerJob] [-x executable] [-r runID]
+
+#include "Randomize.hh"
+#include "globals.hh"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <sys/stat.h>
+
+namespace {
+
+  // Rows of the Ranecu seed table
+  const int seedTableSize = 215;
+
+  void PrintUsage()
+  {
+    std::cerr << " Usage: fpSplit -n events -j jobs -m baseMacro [-o outDir]"
+	      << " [-s firstSeedRow] [-t threadsPerJob] [-x executable] [-r runID]" << std::endl;
+  }
+
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc, char** argv)
+{
+  long nEvents = 0;
+  int nJobs = 0;
+  int firstRow = 0;
+  int nThreads = 0;
+  int runID = 0;
+  std::string baseMacro;
+  std::string outDir = "jobs";
+  std::string executable = "./fiberPanel";
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string option = argv[i];
+    if      (option == "-n") nEvents = std::atol(argv[i+1]);
+    else if (option == "-j") nJobs = std::atoi(argv[i+1]);
+    else if (option == "-m") baseMacro = argv[i+1];
+    else if (option == "-o") outDir = argv[i+1];
+    else if (option == "-s") firstRow = std::atoi(argv[i+1]);
+    else if (option == "-t") nThreads = std::atoi(argv[i+1]);
+    else if (option == "-x") executable = argv[i+1];
+    else if (option == "-r") runID = std::atoi(argv[i+1]);
+    else {
+      PrintUsage();
+      return 1;
+    }
+  }
+  if (argc % 2 == 0 || nEvents <= 0 || nJobs <= 0 || baseMacro.empty() || runID < 0) {
+    PrintUsage();
+    return 1;
+  }
+  if (nJobs > nEvents) nJobs = nEvents;
+  if (firstRow < 0 || firstRow + nJobs > seedTableSize) {
+    std::cerr << "fpSplit: at most " << seedTableSize - firstRow
+	      << " jobs from seed row " << firstRow << std::endl;
+    return 1;
+  }
+
+  mkdir(outDir.c_str(), 0755);
+  std::ofstream manifest(outDir + "/manifest.txt");
+  std::ofstream script(outDir + "/runLocal.sh");
+  if (!manifest || !script) {
+    std::cerr << "fpSplit: can not write to " << outDir << std::endl;
+    return 1;
+  }
+
+  manifest << "# fpSplit manifest: job events seed1 seed2 directory" << std::endl
+	   << "events " << nEvents << std::endl
+	   << "run " << runID << std::endl
+	   << "jobs " << nJobs << std::endl;
+  script << "#!/bin/sh" << std::endl
+	 << "# Run all the jobs of " << outDir << " on this machine, then merge them" << std::endl;
+
+  for (int job = 0; job < nJobs; job++) {
+    // The first jobs take the remainder
+    long jobEvents = nEvents/nJobs + (job < nEvents % nJobs ? 1 : 0);
+    long seeds[2];
+    CLHEP::HepRandom::getTheTableSeeds(seeds, firstRow + job);
+
+    std::string jobDir = outDir + "/job" + std::to_string(job);
+    mkdir(jobDir.c_str(), 0755);
+    std::ofstream macro(jobDir + "/job.mac");
+    if (!macro) {
+      std::cerr << "fpSplit: can not write " << jobDir << "/job.mac" << std::endl;
+      return 1;
+    }
+    macro << "# Job " << job << " of " << nJobs << ", written by fpSplit" << std::endl
+	  << "/control/execute " << baseMacro << std::endl
+	  << "/random/setSeeds " << seeds[0] << " " << seeds[1] << std::endl
+	  << "/analysis/setFileName " << jobDir << "/fiberPanel" << std::endl
+	  << "/FP/maps/fileName " << jobDir << "/fiberPanelMaps.bin" << std::endl
+	  << "/FP/checkpoint/enable true" << std::endl
+	  << "/FP/checkpoint/directory " << jobDir << "/checkpoint" << std::endl
+	  << "/FP/checkpoint/resume true" << std::endl
+	  << "/run/beamOn " << jobEvents << std::endl;
+
+    manifest << "job " << job << " " << jobEvents << " " << seeds[0] << " " << seeds[1]
+	     << " " << jobDir << std::endl;
+    script << executable << " -m " << jobDir << "/job.mac";
+    if (nThreads > 0) script << " -t " << nThreads;
+    script << " > " << jobDir << "/log 2>&1 &" << std::endl;
+  }
+
+  script << "wait" << std::endl
+	 << "./fpMerge -i " << outDir << "/manifest.txt -o " << outDir << "/merged" << std::endl;
+  script.close();
+  chmod((outDir + "/runLocal.sh").c_str(), 0755);
+
+  std::cout << nEvents << " events split into " << nJobs << " jobs in " << outDir
+	    << "; run them with " << outDir << "/runLocal.sh" << std::endl;
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......